@@ -26,12 +26,15 @@ using MessageId = int32_t;
 
 /**
  * @brief Serialization format identifier stored in the message header.
+ *
+ * 0x04 was TLV with Varint-encoded floats. It is no longer accepted.
  */
 enum class Format : uint8_t {
-    Packed = 0x01,    ///< No alignment padding (Alignment = 1).
-    Aligned4 = 0x02,  ///< 4-byte alignment padding.
-    Aligned8 = 0x03,  ///< 8-byte alignment padding.
-    TLV = 0x04,       ///< Tag-Length-Value encoding.
+    Packed = 0x01,     ///< No alignment padding (Alignment = 1).
+    Aligned4 = 0x02,   ///< 4-byte alignment padding.
+    Aligned8 = 0x03,   ///< 8-byte alignment padding.
+    TLV = 0x05,        ///< Tag-Length-Value encoding.
+    TLVZigZag = 0x06,  ///< TLV with ZigZag-encoded signed integers.
 };
 
 /**
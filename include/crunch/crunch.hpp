@@ -3,6 +3,7 @@
 #include <array>
 #include <concepts>
 #include <crunch/crunch_detail.hpp>
+#include <crunch/crunch_view.hpp>
 #include <crunch/fields/crunch_enum.hpp>
 #include <crunch/fields/crunch_string.hpp>
 #include <crunch/integrity/crunch_integrity.hpp>
@@ -26,18 +27,30 @@
  *
  * - @b GetBuffer: Creates a strongly-typed buffer of the maximum serialized
  *   message size for a given Message, Integrity, and Serdes combination.
+ * - @b SerializedSize: Computes the exact serialized size of a message.
  * - @b Validate: Validates field presence and message-level constraints.
  * - @b Serialize: Validates and writes a message into a buffer, appending
- *   integrity checks.
+ *   integrity checks. Also accepts any caller-provided span.
  * - @b Deserialize: Verifies integrity and reads a message from a buffer.
+ * - @b DeserializeFused: Deserialize in a single pass, verifying integrity
+ *   while decoding.
+ * - @b SerializeBatch: Validates and writes a span of messages back to back
+ *   into one contiguous arena.
+ * - @b DeserializeBatch: Decodes a batch of frames into a span of messages,
+ *   reporting an error per frame.
+ * - @b GetView: Verifies integrity once and returns a View that reads fields
+ *   straight out of the buffer.
+ * - @b PatchField: Overwrites one scalar field of a serialized message and
+ *   updates its checksum without reading the rest.
  */
 
 namespace Crunch {
 
-// Expose Buffer, IsBuffer, and Decoder from detail namespace
+// Expose Buffer, IsBuffer, Decoder, and IsDecoder from detail namespace
 using detail::Buffer;
 using detail::Decoder;
 using detail::IsBuffer;
+using detail::IsDecoder;
 
 /**
  * @brief Creates a correctly sized Buffer for the given configuration.
@@ -140,6 +153,72 @@ constexpr void SerializeWithoutValidation(BufferType& buffer,
         buffer.data, message);
 }
 
+/**
+ * @brief Computes the exact number of bytes Serialize writes for a message,
+ * including header and checksum.
+ *
+ * Constant for serdes::StaticLayout; a single pass over the set fields for
+ * serdes::TlvLayout. Never more than `Buffer::Size` of the matching
+ * GetBuffer.
+ *
+ * @tparam Message The CrunchMessage type to measure.
+ * @tparam Integrity The IntegrityPolicy to use.
+ * @tparam Serdes The SizedSerdesPolicy to use.
+ * @param message The message to measure.
+ * @return The serialized size in bytes.
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes>
+    requires IntegrityPolicy<Integrity> && SizedSerdesPolicy<Serdes, Message>
+[[nodiscard]] constexpr std::size_t SerializedSize(
+    const Message& message) noexcept {
+    return detail::SerializedSize<Integrity, Serdes>(message);
+}
+
+/**
+ * @brief Serializes a message straight into a caller-provided span, e.g. a
+ * ring-buffer slot or an arena chunk, without an intermediate Buffer.
+ *
+ * A span holding the maximum frame size, `Buffer::Size` of the matching
+ * GetBuffer, always fits. With a SizedSerdesPolicy a smaller span is also
+ * accepted when SerializedSize of the message fits. Only the returned number
+ * of bytes is meaningful; the rest of the span may be overwritten.
+ *
+ * @tparam Message The CrunchMessage type to serialize.
+ * @tparam Integrity The IntegrityPolicy to use.
+ * @tparam Serdes The SerdesPolicy to use.
+ * @param output The destination span.
+ * @param message The message to serialize.
+ * @return The number of bytes written, or an Error if validation fails or
+ * the span is too small.
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto Serialize(std::span<std::byte> output,
+                             const Message& message) noexcept
+    -> std::expected<std::size_t, Error> {
+    return detail::Serialize<Integrity, Serdes>(output, message);
+}
+
+/**
+ * @brief Serializes a message straight into a caller-provided span without
+ * validation.
+ *
+ * @tparam Message The CrunchMessage type to serialize.
+ * @tparam Integrity The IntegrityPolicy to use.
+ * @tparam Serdes The SerdesPolicy to use.
+ * @param output The destination span.
+ * @param message The message to serialize.
+ * @return The number of bytes written, or an Error if the span is too small.
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto SerializeWithoutValidation(std::span<std::byte> output,
+                                              const Message& message) noexcept
+    -> std::expected<std::size_t, Error> {
+    return detail::SerializeWithoutValidation<Integrity, Serdes>(output,
+                                                                 message);
+}
+
 /**
  * @brief Deserializes a message from a buffer.
  *
@@ -170,4 +249,223 @@ template <typename BufferType, typename Message>
         buffer.serialized_message_span(), out_message);
 }
 
+/**
+ * @brief Deserializes a message from a buffer in a single pass.
+ *
+ * Opt-in alternative to Deserialize that verifies the checksum while the
+ * payload is decoded instead of in a separate pass first. This halves memory
+ * traffic for large messages that are no longer in cache.
+ *
+ * Because decoding starts before the checksum is known, a corrupted buffer
+ * may be partially decoded. When the checksum fails, `out_message` is reset
+ * to a default-constructed Message and Error::integrity() is returned.
+ *
+ * Requires an IncrementalIntegrityPolicy and a FoldingSerdesPolicy (e.g.
+ * integrity::CRC32C with serdes::PackedLayout or serdes::TlvLayout).
+ *
+ * @tparam BufferType The Buffer type
+ * @tparam Message The CrunchMessage type to deserialize into.
+ * @param buffer The source Buffer to read from.
+ * @param out_message Output parameter for the deserialized message.
+ * @return std::optional<Error> std::nullopt on success, or an Error
+ * (Integrity/Deserialization).
+ */
+template <typename BufferType, typename Message>
+    requires IsBuffer<BufferType> && messages::CrunchMessage<Message> &&
+             std::same_as<typename BufferType::MessageType, Message> &&
+             IncrementalIntegrityPolicy<typename BufferType::IntegrityType> &&
+             FoldingSerdesPolicy<typename BufferType::SerdesType, Message>
+[[nodiscard]] constexpr auto DeserializeFused(const BufferType& buffer,
+                                              Message& out_message)
+    -> std::optional<Error> {
+    using Serdes = typename BufferType::SerdesType;
+    using Integrity = typename BufferType::IntegrityType;
+    return detail::DeserializeFused<Integrity, Serdes>(
+        buffer.serialized_message_span(), out_message);
+}
+
+/**
+ * @brief Serializes a batch of messages back to back into one arena.
+ *
+ * Equivalent to calling Serialize on each message, but the header is built
+ * once and capacity is checked once for the whole batch. The arena must hold
+ * `messages.size()` maximum-size frames (see GetBuffer); frames are packed
+ * using their actual sizes.
+ *
+ * Stops at the first message that fails validation and returns its Error.
+ * Frames before it have been written.
+ *
+ * @tparam Message The CrunchMessage type to serialize.
+ * @tparam Integrity The IntegrityPolicy to use.
+ * @tparam Serdes The SerdesPolicy to use.
+ * @param messages The messages to serialize.
+ * @param arena The output, receiving the frames back to back.
+ * @param frame_sizes Receives the size of each frame.
+ * @return The total number of bytes written, or an Error.
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto SerializeBatch(std::span<const Message> messages,
+                                  std::span<std::byte> arena,
+                                  std::span<std::size_t> frame_sizes) noexcept
+    -> std::expected<std::size_t, Error> {
+    return detail::SerializeBatch<Integrity, Serdes>(messages, arena,
+                                                     frame_sizes);
+}
+
+/**
+ * @brief Deserializes a batch of frames into a span of messages.
+ *
+ * Each frame is decoded as by Deserialize and its result is stored in the
+ * matching slot of `errors`. A bad frame does not stop the rest of the batch.
+ *
+ * @tparam Message The CrunchMessage type to deserialize into.
+ * @tparam Integrity The IntegrityPolicy the frames were written with.
+ * @tparam Serdes The SerdesPolicy the frames were written with.
+ * @param frames The serialized messages, each including its checksum.
+ * @param out Receives the message decoded from each frame.
+ * @param errors Receives std::nullopt or the Error for each frame.
+ * @return The number of frames that failed, or an Error if `out` or `errors`
+ * is smaller than `frames`.
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto DeserializeBatch(
+    std::span<const std::span<const std::byte>> frames, std::span<Message> out,
+    std::span<std::optional<Error>> errors) noexcept
+    -> std::expected<std::size_t, Error> {
+    return detail::DeserializeBatch<Integrity, Serdes>(frames, out, errors);
+}
+
+/**
+ * @brief Deserializes a batch of frames packed back to back, as written by
+ * SerializeBatch.
+ *
+ * @tparam Message The CrunchMessage type to deserialize into.
+ * @tparam Integrity The IntegrityPolicy the frames were written with.
+ * @tparam Serdes The SerdesPolicy the frames were written with.
+ * @param arena The frames, back to back.
+ * @param frame_sizes The size of each frame in the arena.
+ * @param out Receives the message decoded from each frame.
+ * @param errors Receives std::nullopt or the Error for each frame.
+ * @return The number of frames that failed, or an Error if `out` or `errors`
+ * is too small or the frame sizes overrun the arena.
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto DeserializeBatch(
+    std::span<const std::byte> arena, std::span<const std::size_t> frame_sizes,
+    std::span<Message> out, std::span<std::optional<Error>> errors) noexcept
+    -> std::expected<std::size_t, Error> {
+    return detail::DeserializeBatch<Integrity, Serdes>(arena, frame_sizes, out,
+                                                       errors);
+}
+
+/**
+ * @brief Creates a zero-copy View of a serialized message.
+ *
+ * Verifies the integrity and header of the buffer once. The returned View
+ * reads each field straight out of the buffer on access instead of decoding
+ * the whole message up front. The buffer must outlive the View.
+ *
+ * Requires an InPlaceSerdesPolicy (e.g. serdes::PackedLayout). Unlike
+ * Deserialize, field and message validators are not run.
+ *
+ * @tparam BufferType The Buffer type
+ * @param buffer The source Buffer to view.
+ * @return The View on success, or an Error (Integrity/Deserialization).
+ */
+template <typename BufferType>
+    requires IsBuffer<BufferType> &&
+             InPlaceSerdesPolicy<typename BufferType::SerdesType,
+                                 typename BufferType::MessageType>
+[[nodiscard]] auto GetView(const BufferType& buffer) noexcept
+    -> std::expected<View<typename BufferType::MessageType,
+                          typename BufferType::SerdesType>,
+                     Error> {
+    using Serdes = typename BufferType::SerdesType;
+    using Integrity = typename BufferType::IntegrityType;
+    using Message = typename BufferType::MessageType;
+    return detail::MakeView<Integrity, Serdes, Message>(
+        buffer.serialized_message_span());
+}
+
+/**
+ * @brief Creates a zero-copy View of a serialized message held in any span,
+ * e.g. a received datagram.
+ *
+ * @tparam Message The CrunchMessage type in the buffer.
+ * @tparam Integrity The IntegrityPolicy the message was written with.
+ * @tparam Serdes The InPlaceSerdesPolicy the message was written with.
+ * @param buffer The serialized message, including the checksum.
+ * @return The View on success, or an Error (Integrity/Deserialization).
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes>
+    requires IntegrityPolicy<Integrity> && InPlaceSerdesPolicy<Serdes, Message>
+[[nodiscard]] auto GetView(std::span<const std::byte> buffer) noexcept
+    -> std::expected<View<Message, Serdes>, Error> {
+    return detail::MakeView<Integrity, Serdes, Message>(buffer);
+}
+
+/**
+ * @brief Overwrites one top-level scalar field of a serialized message in
+ * place.
+ *
+ * The checksum is updated from the field's old and new bytes, so the cost
+ * does not depend on the message size. The rest of the message is not
+ * checked; a corrupted message stays corrupted and still fails Deserialize.
+ *
+ * Requires a PatchableIntegrityPolicy (e.g. integrity::CRC16) and a
+ * FieldWriterSerdesPolicy (e.g. serdes::PackedLayout). The field's
+ * validators are run on the new value.
+ *
+ * @tparam Id The FieldId of the field to overwrite.
+ * @tparam BufferType The Buffer type
+ * @param buffer The Buffer holding the serialized message.
+ * @param value The new value.
+ * @return std::nullopt on success, or an Error.
+ */
+template <FieldId Id, typename BufferType>
+    requires IsBuffer<BufferType> &&
+             messages::has_field_v<typename BufferType::MessageType, Id> &&
+             PatchableIntegrityPolicy<typename BufferType::IntegrityType> &&
+             FieldWriterSerdesPolicy<typename BufferType::SerdesType,
+                                     typename BufferType::MessageType, Id>
+[[nodiscard]] auto PatchField(
+    BufferType& buffer,
+    typename messages::field_t<typename BufferType::MessageType,
+                               Id>::FieldType::ValueType value) noexcept
+    -> std::optional<Error> {
+    using Serdes = typename BufferType::SerdesType;
+    using Integrity = typename BufferType::IntegrityType;
+    using Message = typename BufferType::MessageType;
+    return detail::PatchField<Integrity, Serdes, Message, Id>(
+        std::span<std::byte>{buffer.data.data(), buffer.used_bytes}, value);
+}
+
+/**
+ * @brief Overwrites one top-level scalar field of a serialized message held
+ * in any span, e.g. a frame being forwarded.
+ *
+ * @tparam Message The CrunchMessage type in the buffer.
+ * @tparam Integrity The PatchableIntegrityPolicy the message was written
+ * with.
+ * @tparam Serdes The FieldWriterSerdesPolicy the message was written with.
+ * @tparam Id The FieldId of the field to overwrite.
+ * @param buffer The serialized message, including the checksum.
+ * @param value The new value.
+ * @return std::nullopt on success, or an Error.
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes,
+          FieldId Id>
+    requires messages::has_field_v<Message, Id> &&
+             PatchableIntegrityPolicy<Integrity> &&
+             FieldWriterSerdesPolicy<Serdes, Message, Id>
+[[nodiscard]] auto PatchField(
+    std::span<std::byte> buffer,
+    typename messages::field_t<Message, Id>::FieldType::ValueType
+        value) noexcept -> std::optional<Error> {
+    return detail::PatchField<Integrity, Serdes, Message, Id>(buffer, value);
+}
+
 }  // namespace Crunch
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <crunch/core/crunch_endian.hpp>
 #include <crunch/core/crunch_header.hpp>
 #include <crunch/integrity/crunch_integrity.hpp>
@@ -7,8 +9,12 @@
 #include <crunch/serdes/crunch_serdes.hpp>
 #include <crunch/serdes/crunch_static_layout.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <expected>
+#include <memory>
 #include <span>
+#include <tuple>
 #include <variant>
 /**
  * @brief Internal implementation details for Crunch's public API.
@@ -57,11 +63,24 @@ struct is_buffer : std::false_type {};
 
 template <typename Message, typename Integrity, typename Serdes, std::size_t N>
 struct is_buffer<Buffer<Message, Integrity, Serdes, N>> : std::true_type {};
+
+// Specialized for Decoder once it is defined below.
+template <typename T>
+struct is_decoder : std::false_type {};
 }  // namespace detail
 
+/**
+ * @brief Satisfied by any specialization of Buffer.
+ */
 template <typename T>
 concept IsBuffer = detail::is_buffer<T>::value;
 
+/**
+ * @brief Satisfied by any specialization of Decoder.
+ */
+template <typename T>
+concept IsDecoder = detail::is_decoder<T>::value;
+
 /**
  * @brief Compile-time calculation of the size of a buffer for a given message,
  * integrity, and serdes combination.
@@ -158,6 +177,59 @@ template <typename Message>
     return message.Validate();
 }
 
+/**
+ * @brief Serializes the payload and checksum of a message whose header has
+ * already been written.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type to serialize.
+ * @param buffer The buffer to serialize into, starting with the header. Must
+ * hold at least the serialized size of the message plus its checksum.
+ * @param message The message to serialize.
+ * @return The number of bytes written, including header and checksum.
+ */
+template <typename Integrity, typename Serdes, messages::CrunchMessage Message>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] std::size_t SerializeAfterHeader(
+    std::span<std::byte> buffer, const Message& message) noexcept {
+    constexpr std::size_t ChecksumSize = Integrity::size();
+
+    const std::span<std::byte> payload_span =
+        buffer.first(buffer.size() - ChecksumSize);
+
+    if constexpr (ChecksumSize == 0) {
+        return Serdes::Serialize(message, payload_span);
+    } else {
+        std::size_t bytes_written = 0;
+        std::array<std::byte, ChecksumSize> checksum{};
+        if constexpr (IncrementalIntegrityPolicy<Integrity> &&
+                      FoldingSerdesPolicy<Serdes, Message>) {
+            // Fold each region into the checksum while it is still in cache.
+            auto state = Integrity::init();
+            bytes_written = Serdes::Serialize(
+                message, payload_span,
+                [&state](std::span<const std::byte> chunk) {
+                    state = Integrity::update(state, chunk);
+                });
+            checksum = Integrity::finalize(state);
+        } else {
+            // Serialize Payload (Serdes policy executes logic on full span)
+            bytes_written = Serdes::Serialize(message, payload_span);
+
+            // Calculate checksum over the header and payload (bytes_written
+            // includes both).
+            checksum =
+                Integrity::calculate(payload_span.subspan(0, bytes_written));
+        }
+
+        std::span<std::byte, ChecksumSize> checksum_span(
+            buffer.data() + bytes_written, ChecksumSize);
+        std::copy(checksum.begin(), checksum.end(), checksum_span.begin());
+        return bytes_written + ChecksumSize;
+    }
+}
+
 /**
  * @brief Serializes the message without any validation checks.
  *
@@ -174,30 +246,10 @@ template <typename Integrity, typename Serdes, messages::CrunchMessage Message,
 
 [[nodiscard]] std::size_t SerializeWithoutValidation(
     std::array<std::byte, N>& buffer, const Message& message) noexcept {
-    constexpr std::size_t ChecksumSize = Integrity::size();
-    constexpr std::size_t PayloadSize = N - ChecksumSize;
-
-    std::span<std::byte, PayloadSize> payload_span(buffer.data(), PayloadSize);
-
     // Write Header
-    WriteHeader<Message, Serdes>(payload_span);
+    WriteHeader<Message, Serdes>(buffer);
 
-    // Serialize Payload (Serdes policy executes logic on full span)
-    const std::size_t bytes_written = Serdes::Serialize(message, payload_span);
-
-    // Calculate and Append Checksum
-    if constexpr (ChecksumSize > 0) {
-        // Calculate checksum over the header and payload (bytes_written
-        // includes both).
-        std::span<std::byte> used_payload_span =
-            payload_span.subspan(0, bytes_written);
-        auto checksum = Integrity::calculate(used_payload_span);
-
-        std::span<std::byte, ChecksumSize> checksum_span(
-            buffer.data() + bytes_written, ChecksumSize);
-        std::copy(checksum.begin(), checksum.end(), checksum_span.begin());
-    }
-    return bytes_written + ChecksumSize;
+    return SerializeAfterHeader<Integrity, Serdes>(std::span{buffer}, message);
 }
 
 /**
@@ -230,36 +282,26 @@ template <typename Integrity, typename Serdes, messages::CrunchMessage Message,
 }
 
 /**
- * @brief implementation of Deserialize.
- *
- * First, the integrity policy is executed to validate the buffer.
- * Then, the header is deserialized. Finally, the payload is
- * delegated to the Serdes policy for deserialization.
+ * @brief Verifies the checksum at the end of a serialized message.
  *
  * @tparam Integrity The integrity policy to use.
- * @tparam Serdes The serialization policy to use.
- * @tparam Message The message type to deserialize into.
- * @param buffer The buffer to deserialize from.
- * @param message The message object to populate.
- * @return std::nullopt on success, or an Error if integrity or deserialization
- * fails.
+ * @param buffer The serialized message, including the checksum.
+ * @return The payload (the buffer without the checksum), or an Error.
  */
-template <typename Integrity, typename Serdes, typename Message>
-    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message> &&
-             messages::CrunchMessage<Message>
-[[nodiscard]] auto Deserialize(std::span<const std::byte> buffer,
-                               Message& message) noexcept
-    -> std::optional<Error> {
+template <typename Integrity>
+    requires IntegrityPolicy<Integrity>
+[[nodiscard]] auto VerifyIntegrity(std::span<const std::byte> buffer) noexcept
+    -> std::expected<std::span<const std::byte>, Error> {
     constexpr std::size_t ChecksumSize = Integrity::size();
 
     if (buffer.size() < ChecksumSize) {
-        return Error::deserialization("buffer too small for checksum");
+        return std::unexpected(
+            Error::deserialization("buffer too small for checksum"));
     }
     const std::size_t PayloadSize = buffer.size() - ChecksumSize;
 
     std::span<const std::byte> payload_span = buffer.subspan(0, PayloadSize);
 
-    // Execute Integrity Check per policy
     if constexpr (ChecksumSize > 0) {
         const auto expected_checksum = Integrity::calculate(payload_span);
         std::span<const std::byte, ChecksumSize> actual_checksum_span(
@@ -270,9 +312,112 @@ template <typename Integrity, typename Serdes, typename Message>
             std::equal(expected_checksum.begin(), expected_checksum.end(),
                        actual_checksum_span.begin());
         if (!match) {
-            return Error::integrity();
+            return std::unexpected(Error::integrity());
+        }
+    }
+    return payload_span;
+}
+
+/**
+ * @brief implementation of SerializedSize.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type to measure.
+ * @param message The message to measure.
+ * @return The exact number of bytes Serialize writes, including the checksum.
+ */
+template <typename Integrity, typename Serdes, messages::CrunchMessage Message>
+    requires IntegrityPolicy<Integrity> && SizedSerdesPolicy<Serdes, Message>
+[[nodiscard]] constexpr std::size_t SerializedSize(
+    const Message& message) noexcept {
+    return Serdes::SerializedSize(message) + Integrity::size();
+}
+
+/**
+ * @brief implementation of SerializeWithoutValidation into a caller-provided
+ * span.
+ *
+ * A span smaller than GetBufferSize is accepted when the Serdes policy can
+ * report the exact size and the message fits.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type to serialize.
+ * @param output The span to serialize into.
+ * @param message The message to serialize.
+ * @return The number of bytes written, or an Error if output is too small.
+ */
+template <typename Integrity, typename Serdes, messages::CrunchMessage Message>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto SerializeWithoutValidation(std::span<std::byte> output,
+                                              const Message& message) noexcept
+    -> std::expected<std::size_t, Error> {
+    constexpr std::size_t N = GetBufferSize<Message, Integrity, Serdes>();
+    std::size_t frame_size = N;
+    if (output.size() < N) {
+        if constexpr (SizedSerdesPolicy<Serdes, Message>) {
+            frame_size = SerializedSize<Integrity, Serdes>(message);
+        }
+        if (output.size() < frame_size) {
+            return std::unexpected(
+                Error::capacity_exceeded(0, "output smaller than frame size"));
         }
     }
+    const std::span<std::byte> frame = output.first(frame_size);
+    static_cast<void>(WriteHeader<Message, Serdes>(frame));
+    return SerializeAfterHeader<Integrity, Serdes>(frame, message);
+}
+
+/**
+ * @brief implementation of Serialize into a caller-provided span.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type to serialize.
+ * @param output The span to serialize into. Must hold at least
+ * GetBufferSize bytes.
+ * @param message The message to serialize.
+ * @return The number of bytes written, or an Error.
+ */
+template <typename Integrity, typename Serdes, messages::CrunchMessage Message>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto Serialize(std::span<std::byte> output,
+                             const Message& message) noexcept
+    -> std::expected<std::size_t, Error> {
+    if (auto err = Validate(message); err.has_value()) {
+        return std::unexpected(*err);
+    }
+    return SerializeWithoutValidation<Integrity, Serdes>(output, message);
+}
+
+/**
+ * @brief implementation of Deserialize.
+ *
+ * First, the integrity policy is executed to validate the buffer.
+ * Then, the header is deserialized. Finally, the payload is
+ * delegated to the Serdes policy for deserialization.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type to deserialize into.
+ * @param buffer The buffer to deserialize from.
+ * @param message The message object to populate.
+ * @return std::nullopt on success, or an Error if integrity or deserialization
+ * fails.
+ */
+template <typename Integrity, typename Serdes, typename Message>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message> &&
+             messages::CrunchMessage<Message>
+[[nodiscard]] auto Deserialize(std::span<const std::byte> buffer,
+                               Message& message) noexcept
+    -> std::optional<Error> {
+    // Execute Integrity Check per policy
+    const auto payload_result = VerifyIntegrity<Integrity>(buffer);
+    if (!payload_result) {
+        return payload_result.error();
+    }
+    const std::span<const std::byte> payload_span = *payload_result;
 
     // Validate Header (Version, Format, MessageId)
     auto header_result = ValidateHeader<Message, Serdes>(payload_span);
@@ -294,6 +439,262 @@ template <typename Integrity, typename Serdes, typename Message>
     return std::nullopt;
 }
 
+/**
+ * @brief Single-pass implementation of Deserialize.
+ *
+ * Decodes the payload and updates the checksum over each region as the Serdes
+ * policy consumes it, so every byte is read once. Any bytes the policy did not
+ * consume are folded in before the checksum is compared.
+ *
+ * If the checksum does not match, the message is reset to its
+ * default-constructed state and Error::integrity() is returned, even when
+ * decoding failed first. Other errors are only reported once the checksum has
+ * been confirmed.
+ *
+ * @tparam Integrity The incremental integrity policy to use.
+ * @tparam Serdes The folding serialization policy to use.
+ * @tparam Message The message type to deserialize into.
+ * @param buffer The buffer to deserialize from.
+ * @param message The message object to populate.
+ * @return std::nullopt on success, or an Error if integrity or deserialization
+ * fails.
+ */
+template <typename Integrity, typename Serdes, typename Message>
+    requires IncrementalIntegrityPolicy<Integrity> &&
+             FoldingSerdesPolicy<Serdes, Message> &&
+             messages::CrunchMessage<Message>
+[[nodiscard]] constexpr auto DeserializeFused(
+    std::span<const std::byte> buffer, Message& message) noexcept
+    -> std::optional<Error> {
+    constexpr std::size_t ChecksumSize = Integrity::size();
+
+    if (buffer.size() < ChecksumSize) {
+        return Error::deserialization("buffer too small for checksum");
+    }
+    const std::size_t PayloadSize = buffer.size() - ChecksumSize;
+    std::span<const std::byte> payload_span = buffer.subspan(0, PayloadSize);
+
+    auto state = Integrity::init();
+    std::size_t consumed = 0;
+    const auto fold = [&](std::span<const std::byte> chunk) {
+        state = Integrity::update(state, chunk);
+        consumed += chunk.size();
+    };
+
+    // Folds whatever was not consumed, then checks the checksum.
+    const auto verify = [&]() -> bool {
+        fold(payload_span.subspan(consumed));
+        const auto expected_checksum = Integrity::finalize(state);
+        if (!std::equal(expected_checksum.begin(), expected_checksum.end(),
+                        buffer.subspan(PayloadSize).begin())) {
+            message = Message{};
+            return false;
+        }
+        return true;
+    };
+
+    std::optional<Error> err;
+    if (auto header_result = ValidateHeader<Message, Serdes>(payload_span);
+        !header_result) {
+        err = header_result.error();
+    } else {
+        err = Serdes::Deserialize(payload_span, message, fold);
+    }
+
+    if (!verify()) {
+        return Error::integrity();
+    }
+    if (err.has_value()) {
+        return err;
+    }
+
+    // Validate deserialized message
+    return Validate(message);
+}
+
+/**
+ * @brief implementation of SerializeBatch.
+ *
+ * The header is the same for every frame, so it is built once and copied.
+ * Capacity is checked once up front, leaving a loop body with no
+ * cross-frame dependencies besides the running offset.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type to serialize.
+ * @param messages The messages to serialize.
+ * @param arena The output, receiving the frames back to back.
+ * @param frame_sizes Receives the size of each frame.
+ * @return The total number of bytes written, or an Error.
+ */
+template <typename Integrity, typename Serdes, messages::CrunchMessage Message>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto SerializeBatch(std::span<const Message> messages,
+                                  std::span<std::byte> arena,
+                                  std::span<std::size_t> frame_sizes) noexcept
+    -> std::expected<std::size_t, Error> {
+    constexpr std::size_t N = GetBufferSize<Message, Integrity, Serdes>();
+    if (frame_sizes.size() < messages.size()) {
+        return std::unexpected(
+            Error::capacity_exceeded(0, "frame_sizes smaller than batch"));
+    }
+    if (arena.size() / N < messages.size()) {
+        return std::unexpected(
+            Error::capacity_exceeded(0, "arena too small for batch"));
+    }
+
+    std::array<std::byte, StandardHeaderSize> header;
+    static_cast<void>(WriteHeader<Message, Serdes>(header));
+
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        if (auto err = Validate(messages[i]); err.has_value()) {
+            return std::unexpected(*err);
+        }
+        const std::span<std::byte, N> frame(arena.data() + offset, N);
+        std::memcpy(frame.data(), header.data(), header.size());
+        frame_sizes[i] =
+            SerializeAfterHeader<Integrity, Serdes>(frame, messages[i]);
+        offset += frame_sizes[i];
+    }
+    return offset;
+}
+
+/**
+ * @brief implementation of DeserializeBatch.
+ *
+ * Each frame is decoded independently, so one bad frame does not stop the
+ * others.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type to deserialize into.
+ * @param frames The serialized messages, each including its checksum.
+ * @param out Receives the message decoded from each frame.
+ * @param errors Receives the result of each frame.
+ * @return The number of frames that failed, or an Error if out or errors is
+ * smaller than frames.
+ */
+template <typename Integrity, typename Serdes, messages::CrunchMessage Message>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto DeserializeBatch(
+    std::span<const std::span<const std::byte>> frames, std::span<Message> out,
+    std::span<std::optional<Error>> errors) noexcept
+    -> std::expected<std::size_t, Error> {
+    if (out.size() < frames.size() || errors.size() < frames.size()) {
+        return std::unexpected(
+            Error::capacity_exceeded(0, "output smaller than batch"));
+    }
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        errors[i] = Deserialize<Integrity, Serdes>(frames[i], out[i]);
+        failed += errors[i].has_value() ? 1 : 0;
+    }
+    return failed;
+}
+
+/**
+ * @brief implementation of DeserializeBatch for frames packed back to back,
+ * as written by SerializeBatch.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type to deserialize into.
+ * @param arena The frames, back to back.
+ * @param frame_sizes The size of each frame in the arena.
+ * @param out Receives the message decoded from each frame.
+ * @param errors Receives the result of each frame.
+ * @return The number of frames that failed, or an Error if out or errors is
+ * smaller than frame_sizes or the frames overrun the arena.
+ */
+template <typename Integrity, typename Serdes, messages::CrunchMessage Message>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto DeserializeBatch(
+    std::span<const std::byte> arena, std::span<const std::size_t> frame_sizes,
+    std::span<Message> out, std::span<std::optional<Error>> errors) noexcept
+    -> std::expected<std::size_t, Error> {
+    if (out.size() < frame_sizes.size() || errors.size() < frame_sizes.size()) {
+        return std::unexpected(
+            Error::capacity_exceeded(0, "output smaller than batch"));
+    }
+    std::size_t offset = 0;
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < frame_sizes.size(); ++i) {
+        if (frame_sizes[i] > arena.size() - offset) {
+            return std::unexpected(
+                Error::deserialization("frame sizes overrun arena"));
+        }
+        errors[i] = Deserialize<Integrity, Serdes>(
+            arena.subspan(offset, frame_sizes[i]), out[i]);
+        failed += errors[i].has_value() ? 1 : 0;
+        offset += frame_sizes[i];
+    }
+    return failed;
+}
+
+/**
+ * @brief implementation of PatchField.
+ *
+ * Checks the header, saves the field's current bytes, lets the Serdes policy
+ * overwrite the field, then patches the checksum from the old and new bytes.
+ * Only the header, the field and the checksum are read.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type in the buffer.
+ * @tparam Id The FieldId of the field to overwrite.
+ * @param buffer The serialized message, including the checksum.
+ * @param value The new value.
+ * @return std::nullopt on success, or an Error if the buffer is invalid or
+ * the value fails validation.
+ */
+template <typename Integrity, typename Serdes, typename Message, FieldId Id>
+    requires PatchableIntegrityPolicy<Integrity> &&
+             FieldWriterSerdesPolicy<Serdes, Message, Id> &&
+             messages::CrunchMessage<Message>
+[[nodiscard]] auto PatchField(
+    std::span<std::byte> buffer,
+    typename messages::field_t<Message, Id>::FieldType::ValueType
+        value) noexcept -> std::optional<Error> {
+    using FieldType = typename messages::field_t<Message, Id>::FieldType;
+    constexpr std::size_t ChecksumSize = Integrity::size();
+    constexpr std::size_t Begin = Serdes::template OffsetOf<Message, Id>();
+    constexpr std::size_t End =
+        Serdes::template ValueEndOffset<FieldType>(Begin + 1);
+
+    if (buffer.size() < ChecksumSize) {
+        return Error::deserialization("buffer too small for checksum");
+    }
+    const std::span<std::byte> payload =
+        buffer.first(buffer.size() - ChecksumSize);
+    if (auto header_result = ValidateHeader<Message, Serdes>(payload);
+        !header_result) {
+        return header_result.error();
+    }
+    if (payload.size() < End) {
+        return Error::deserialization("buffer too small for message");
+    }
+
+    std::array<std::byte, End - Begin> before;
+    std::memcpy(before.data(), payload.data() + Begin, before.size());
+    if (auto err = Serdes::template WriteField<Message, Id>(payload, value);
+        err.has_value()) {
+        return err;
+    }
+
+    if constexpr (ChecksumSize > 0) {
+        std::array<std::byte, ChecksumSize> checksum;
+        std::memcpy(checksum.data(), payload.data() + payload.size(),
+                    ChecksumSize);
+        checksum = Integrity::patch(checksum, before,
+                                    payload.subspan(Begin, End - Begin),
+                                    payload.size() - End);
+        std::memcpy(payload.data() + payload.size(), checksum.data(),
+                    ChecksumSize);
+    }
+    return std::nullopt;
+}
+
 /**
  * @brief Counts how many messages have the given message ID.
  */
@@ -313,6 +714,88 @@ consteval bool HasDuplicateMessageIds() {
 template <typename... Messages>
 concept UniqueMessageIds = !HasDuplicateMessageIds<Messages...>();
 
+/**
+ * @brief Combines several callables into one overload set.
+ */
+template <typename... Fs>
+struct Overloaded : Fs... {
+    using Fs::operator()...;
+};
+
+/**
+ * @brief Compile-time dispatch from a MessageId to the index of the message
+ * type that owns it.
+ *
+ * Compact ids map through a dense table indexed by `id - MinId`; sparse
+ * ids fall back to a binary search over the sorted ids.
+ *
+ * @tparam Messages The message types (must have unique message IDs).
+ */
+template <typename... Messages>
+struct MessageDispatch {
+    static constexpr std::size_t Count = sizeof...(Messages);
+    static_assert(Count < UINT16_MAX, "too many messages for dispatch");
+
+    /// Message ids in declaration order.
+    static constexpr std::array<MessageId, Count> Ids{Messages::message_id...};
+
+    static constexpr MessageId MinId =
+        Count == 0 ? 0 : *std::ranges::min_element(Ids);
+    static constexpr MessageId MaxId =
+        Count == 0 ? 0 : *std::ranges::max_element(Ids);
+    static constexpr std::size_t Span =
+        Count == 0 ? 0
+                   : static_cast<std::size_t>(static_cast<int64_t>(MaxId) -
+                                              static_cast<int64_t>(MinId)) +
+                         1;
+
+    /// Use the dense table when it is at most a few entries per message.
+    static constexpr bool Dense = Span <= 4 * Count;
+
+    /// Dense: `id - MinId` -> message index, Count for unused ids.
+    static constexpr auto Table = [] {
+        std::array<uint16_t, Dense ? Span : 0> table{};
+        table.fill(static_cast<uint16_t>(Count));
+        if constexpr (Dense) {
+            for (std::size_t i = 0; i < Count; ++i) {
+                table[static_cast<std::size_t>(Ids[i] - MinId)] =
+                    static_cast<uint16_t>(i);
+            }
+        }
+        return table;
+    }();
+
+    /// Sparse: (id, message index) sorted by id.
+    static constexpr auto Sorted = [] {
+        std::array<std::pair<MessageId, uint16_t>, Dense ? 0 : Count> sorted{};
+        if constexpr (!Dense) {
+            for (std::size_t i = 0; i < Count; ++i) {
+                sorted[i] = {Ids[i], static_cast<uint16_t>(i)};
+            }
+            std::ranges::sort(sorted);
+        }
+        return sorted;
+    }();
+
+    /**
+     * @brief Finds the index of the message type with the given id.
+     * @param id The MessageId to look for.
+     * @return The message index, or Count if no message has this id.
+     */
+    [[nodiscard]] static constexpr std::size_t index_of(MessageId id) noexcept {
+        if constexpr (Dense) {
+            // Ids below MinId wrap around and fail the bounds check.
+            const std::size_t slot =
+                static_cast<uint32_t>(id) - static_cast<uint32_t>(MinId);
+            return slot < Span ? Table[slot] : Count;
+        } else {
+            const auto it = std::ranges::lower_bound(
+                Sorted, id, {}, &std::pair<MessageId, uint16_t>::first);
+            return it != Sorted.end() && it->first == id ? it->second : Count;
+        }
+    }
+};
+
 /**
  * @brief Decoder class for deserializing one of N possible message types from a
  * buffer.
@@ -329,41 +812,220 @@ class Decoder {
    public:
     using VariantType = std::variant<Messages...>;
 
+    /// Caller-owned storage for Dispatch, one reusable slot per type.
+    using Storage = std::tuple<Messages...>;
+
+    using SerdesType = Serdes;
+    using IntegrityType = Integrity;
+
+    /// The largest frame of any message type, including the checksum.
+    static constexpr std::size_t MaxFrameSize =
+        std::max({GetBufferSize<Messages, Integrity, Serdes>()...});
+
+    /**
+     * @brief Reads the total length of the frame at the front of a buffer,
+     * so frames can be cut out of a byte stream before they are decoded.
+     *
+     * Only the first `Serdes::FramePrefixSize` bytes are read. The header's
+     * version, format and message id are checked, and the length is bounded
+     * by the largest frame of the header's message type.
+     *
+     * @param prefix The start of a frame, at least Serdes::FramePrefixSize
+     * bytes.
+     * @return The frame length including the checksum, or an Error.
+     */
+    [[nodiscard]] static constexpr auto FrameLength(
+        std::span<const std::byte> prefix) noexcept
+        -> std::expected<std::size_t, Error>
+        requires(FramedSerdesPolicy<Serdes, Messages> && ...)
+    {
+        if (prefix.size() < Serdes::FramePrefixSize) {
+            return std::unexpected(
+                Error::deserialization("buffer too small for frame prefix"));
+        }
+        const auto header = GetHeader(prefix);
+        if (!header) {
+            return std::unexpected(header.error());
+        }
+        if (header->version != CrunchVersion) {
+            return std::unexpected(
+                Error::deserialization("unsupported crunch version"));
+        }
+        if (header->format != Serdes::GetFormat()) {
+            return std::unexpected(Error::invalid_format());
+        }
+
+        const std::size_t index = IdDispatch::index_of(header->message_id);
+        if (index == IdDispatch::Count) {
+            return std::unexpected(Error::invalid_message_id());
+        }
+        const std::size_t length = FrameLengthOf[index](prefix);
+        if (length > MaxFrameSizeOf[index]) {
+            return std::unexpected(
+                Error::deserialization("frame length exceeds message size"));
+        }
+        return length;
+    }
+
     [[nodiscard]] constexpr std::optional<Error> Decode(
-        std::span<const std::byte> buffer, VariantType& out_message) {
+        std::span<const std::byte> buffer, VariantType& out_message) const {
         // Validate Header
         const auto header = GetHeader(buffer);
         if (!header) {
             return header.error();
         }
 
-        // Find message which matches header's message_id and deserialize
-        std::optional<Error> result = Error::invalid_message_id();
-        ([&]() -> bool {
-            if (Messages::message_id == header->message_id) {
-                Messages msg{};
-                auto err = Deserialize<Integrity, Serdes>(buffer, msg);
-                if (err) {
-                    result = err;
-                } else {
-                    out_message = std::move(msg);
-                    result = std::nullopt;
-                }
-                return true;
-            }
-            return false;
-        }() || ...);
+        // Jump straight to the message type which matches the header's
+        // message_id.
+        const std::size_t index = IdDispatch::index_of(header->message_id);
+        if (index == IdDispatch::Count) {
+            return Error::invalid_message_id();
+        }
+        return DecodeAs[index](buffer, out_message);
+    }
 
-        return result;
+    /**
+     * @brief Decodes a buffer into caller-owned storage and calls the handler
+     * for its message type, without building a variant.
+     *
+     * The buffer is deserialized straight into the slot in `storage` for the
+     * header's message type, leaving no field from an earlier frame set. On
+     * success the matching handler is called with a reference to that slot,
+     * which stays valid until the next Dispatch into the same storage. On
+     * failure no handler is called.
+     *
+     * @param buffer The serialized message, including its checksum.
+     * @param storage Reusable storage holding one message of each type.
+     * @param handlers Callables which together accept `Messages&` for every
+     * message type, e.g. one lambda per type.
+     * @return std::nullopt on success, or an Error.
+     */
+    template <typename... Handlers>
+        requires(std::invocable<Overloaded<std::decay_t<Handlers>...>&,
+                                Messages&> &&
+                 ...)
+    [[nodiscard]] constexpr std::optional<Error> Dispatch(
+        std::span<const std::byte> buffer, Storage& storage,
+        Handlers&&... handlers) const {
+        const auto header = GetHeader(buffer);
+        if (!header) {
+            return header.error();
+        }
+
+        const std::size_t index = IdDispatch::index_of(header->message_id);
+        if (index == IdDispatch::Count) {
+            return Error::invalid_message_id();
+        }
+        using Visitor = Overloaded<std::decay_t<Handlers>...>;
+        Visitor visitor{std::forward<Handlers>(handlers)...};
+        return DispatchAs<Visitor>[index](buffer, storage, visitor);
+    }
+
+    /**
+     * @brief Decodes each frame of a batch into the matching slot of `out`.
+     *
+     * @param frames The serialized messages, each including its checksum.
+     * @param out Receives the message decoded from each frame.
+     * @param errors Receives the result of each frame.
+     * @return The number of frames that failed, or an Error if `out` or
+     * `errors` is smaller than `frames`.
+     */
+    [[nodiscard]] constexpr auto DecodeBatch(
+        std::span<const std::span<const std::byte>> frames,
+        std::span<VariantType> out,
+        std::span<std::optional<Error>> errors) const
+        -> std::expected<std::size_t, Error> {
+        if (out.size() < frames.size() || errors.size() < frames.size()) {
+            return std::unexpected(
+                Error::capacity_exceeded(0, "output smaller than batch"));
+        }
+        std::size_t failed = 0;
+        for (std::size_t i = 0; i < frames.size(); ++i) {
+            errors[i] = Decode(frames[i], out[i]);
+            failed += errors[i].has_value() ? 1 : 0;
+        }
+        return failed;
     }
 
    private:
-    std::variant<
-        // Variant holding all possible buffer configurations for the given
-        // message types, integrity, and serdes
-        Buffer<Messages, Integrity, Serdes,
-               GetBufferSize<Messages, Integrity, Serdes>()>...>
-        buffer;
+    using IdDispatch = MessageDispatch<Messages...>;
+
+    /// Length of a frame of the given message type, including the checksum.
+    template <typename Message>
+    [[nodiscard]] static constexpr std::size_t frame_length_as(
+        std::span<const std::byte> prefix) noexcept {
+        return Serdes::template FrameLength<Message>(prefix) +
+               Integrity::size();
+    }
+
+    using FrameLengthFn = std::size_t (*)(std::span<const std::byte>);
+
+    /// Message index -> frame length reader for that message type.
+    static constexpr std::array<FrameLengthFn, IdDispatch::Count>
+        FrameLengthOf{&frame_length_as<Messages>...};
+
+    /// Message index -> largest frame of that message type.
+    static constexpr std::array<std::size_t, IdDispatch::Count>
+        MaxFrameSizeOf{GetBufferSize<Messages, Integrity, Serdes>()...};
+
+    /**
+     * @brief Emplaces a Message in out_message and deserializes the frame
+     * straight into it, avoiding a temporary and a copy of the message.
+     *
+     * On failure out_message is reset to a default-constructed Message.
+     */
+    template <typename Message>
+    [[nodiscard]] static constexpr std::optional<Error> decode_as(
+        std::span<const std::byte> frame, VariantType& out_message) {
+        Message& msg = out_message.template emplace<Message>();
+        if (auto err = Deserialize<Integrity, Serdes>(frame, msg)) {
+            out_message.template emplace<Message>();
+            return err;
+        }
+        return std::nullopt;
+    }
+
+    using DecodeFn = std::optional<Error> (*)(std::span<const std::byte>,
+                                              VariantType&);
+
+    /// Message index -> decoder for that message type.
+    static constexpr std::array<DecodeFn, IdDispatch::Count> DecodeAs{
+        &decode_as<Messages>...};
+
+    /**
+     * @brief Deserializes a frame into the Message slot of storage and calls
+     * the visitor with it.
+     */
+    template <typename Message, typename Visitor>
+    [[nodiscard]] static constexpr std::optional<Error> dispatch_as(
+        std::span<const std::byte> frame, Storage& storage, Visitor& visitor) {
+        Message& msg = std::get<Message>(storage);
+        // Rebuild the slot unless the policy promises to overwrite every
+        // field, so nothing survives from the previous frame.
+        if constexpr (!OverwritingSerdesPolicy<Serdes, Message>) {
+            std::destroy_at(&msg);
+            std::construct_at(&msg);
+        }
+        if (auto err = Deserialize<Integrity, Serdes>(frame, msg)) {
+            return err;
+        }
+        visitor(msg);
+        return std::nullopt;
+    }
+
+    template <typename Visitor>
+    using DispatchFn = std::optional<Error> (*)(std::span<const std::byte>,
+                                                Storage&, Visitor&);
+
+    /// Message index -> dispatcher for that message type.
+    template <typename Visitor>
+    static constexpr std::array<DispatchFn<Visitor>, IdDispatch::Count>
+        DispatchAs{&dispatch_as<Messages, Visitor>...};
 };
 
+namespace detail {
+template <typename Serdes, typename Integrity, typename... Messages>
+struct is_decoder<Decoder<Serdes, Integrity, Messages...>> : std::true_type {};
+}  // namespace detail
+
 }  // namespace Crunch::detail
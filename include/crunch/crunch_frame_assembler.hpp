@@ -0,0 +1,169 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <crunch/crunch.hpp>
+#include <cstddef>
+#include <cstring>
+#include <expected>
+#include <span>
+
+/**
+ * @brief Sans-IO reassembly of frames from a byte stream.
+ *
+ * Kept out of crunch.hpp since only stream transports need it.
+ */
+namespace Crunch {
+
+/**
+ * @brief Cuts complete frames out of a stream of arbitrarily sized chunks,
+ * such as reads from a TCP socket or a pipe.
+ *
+ * Bytes are appended to a fixed-size ring, either copied in with Feed or
+ * read straight into WriteSpan and published with Commit. NextFrame uses the
+ * header and the Serdes policy's length prefix (or the fixed size of a
+ * static layout) to find where each frame ends. A frame which sits
+ * contiguously in the ring is returned as a span into the ring. Only a frame
+ * which wraps the end of the ring is copied, into a scratch buffer, first.
+ *
+ * The assembler does no IO and no allocation. Frames are handed back to the
+ * caller, who passes them to DecoderType::Decode or Dispatch.
+ *
+ * @tparam DecoderType The Decoder whose messages arrive on the stream.
+ * @tparam Capacity The ring size in bytes. At least the largest frame.
+ */
+template <typename DecoderType,
+          std::size_t Capacity = 2 * DecoderType::MaxFrameSize>
+    requires IsDecoder<DecoderType>
+class FrameAssembler {
+    static_assert(Capacity >= DecoderType::MaxFrameSize,
+                  "FrameAssembler capacity must fit the largest frame.");
+
+    static constexpr std::size_t PrefixSize =
+        DecoderType::SerdesType::FramePrefixSize;
+
+   public:
+    /**
+     * @brief The free space at the end of the ring which can be written
+     * without wrapping.
+     *
+     * Read from the transport straight into this span, then call Commit with
+     * the number of bytes read. The span is empty when the ring is full.
+     *
+     * @return A span over the writable bytes.
+     */
+    [[nodiscard]] constexpr std::span<std::byte> WriteSpan() noexcept {
+        const std::size_t tail = (head_ + size_) % Capacity;
+        const std::size_t free = Capacity - size_;
+        return std::span<std::byte>{ring_}.subspan(
+            tail, std::min(free, Capacity - tail));
+    }
+
+    /**
+     * @brief Publishes bytes written into WriteSpan.
+     * @param count The number of bytes written, at most WriteSpan().size().
+     */
+    constexpr void Commit(std::size_t count) noexcept { size_ += count; }
+
+    /**
+     * @brief Copies as much of a chunk as fits into the ring.
+     * @param chunk The bytes received.
+     * @return The number of bytes accepted. Bytes beyond that did not fit and
+     * must be fed again after frames have been taken with NextFrame.
+     */
+    [[nodiscard]] constexpr std::size_t Feed(
+        std::span<const std::byte> chunk) noexcept {
+        std::size_t accepted = 0;
+        // At most two copies: up to the end of the ring, then from its start.
+        while (accepted < chunk.size()) {
+            const std::span<std::byte> free = WriteSpan();
+            if (free.empty()) {
+                break;
+            }
+            const std::size_t count =
+                std::min(free.size(), chunk.size() - accepted);
+            std::memcpy(free.data(), chunk.data() + accepted, count);
+            Commit(count);
+            accepted += count;
+        }
+        return accepted;
+    }
+
+    /**
+     * @brief Takes the next complete frame from the ring.
+     *
+     * The returned span stays valid until the next call to NextFrame or
+     * Reset, which releases its bytes. Feeding more data meanwhile is safe.
+     *
+     * If the bytes at the front of the ring are not a valid frame prefix
+     * (wrong version or format, unknown message id, or a length larger than
+     * the message allows) the error is returned and one byte is dropped, so
+     * repeated calls scan forward to the next plausible frame. The decoder's
+     * integrity check rejects any false match.
+     *
+     * @return The frame including its checksum, an empty span if no complete
+     * frame is buffered yet, or an Error.
+     */
+    [[nodiscard]] constexpr auto NextFrame() noexcept
+        -> std::expected<std::span<const std::byte>, Error> {
+        consume(pending_);
+        pending_ = 0;
+
+        if (size_ < PrefixSize) {
+            return std::span<const std::byte>{};
+        }
+        std::array<std::byte, PrefixSize> prefix;
+        copy_out(prefix);
+
+        const auto length = DecoderType::FrameLength(prefix);
+        if (!length) {
+            consume(1);
+            return std::unexpected(length.error());
+        }
+        if (size_ < *length) {
+            return std::span<const std::byte>{};
+        }
+
+        pending_ = *length;
+        if (head_ + *length <= Capacity) {
+            return std::span<const std::byte>{ring_}.subspan(head_, *length);
+        }
+        const std::span<std::byte> frame =
+            std::span<std::byte>{scratch_}.first(*length);
+        copy_out(frame);
+        return frame;
+    }
+
+    /// The number of bytes buffered, including the last returned frame.
+    [[nodiscard]] constexpr std::size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Drops all buffered bytes, e.g. after the transport reconnects.
+    constexpr void Reset() noexcept {
+        head_ = 0;
+        size_ = 0;
+        pending_ = 0;
+    }
+
+   private:
+    /// Copies the first out.size() buffered bytes into out.
+    constexpr void copy_out(std::span<std::byte> out) const noexcept {
+        const std::size_t first = std::min(out.size(), Capacity - head_);
+        std::memcpy(out.data(), ring_.data() + head_, first);
+        std::memcpy(out.data() + first, ring_.data(), out.size() - first);
+    }
+
+    constexpr void consume(std::size_t count) noexcept {
+        head_ = (head_ + count) % Capacity;
+        size_ -= count;
+    }
+
+    std::array<std::byte, Capacity> ring_{};
+    std::array<std::byte, DecoderType::MaxFrameSize> scratch_{};
+    std::size_t head_{0};
+    std::size_t size_{0};
+    std::size_t pending_{0};
+};
+
+}  // namespace Crunch
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <crunch/crunch.hpp>
+#include <cstddef>
+#include <expected>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Multi-threaded batch decoding.
+ *
+ * Kept out of crunch.hpp so that targets without threads never include
+ * <thread>.
+ */
+namespace Crunch {
+
+namespace detail {
+
+/**
+ * @brief Splits the indices [0, count) into one contiguous slab per thread
+ * and runs `decode_slab(begin, end)` on each.
+ *
+ * The calling thread decodes the first slab. Every slab writes only its own
+ * range of the output spans and its own failure counter, so the workers
+ * share nothing until they are joined.
+ *
+ * @param count The number of frames.
+ * @param max_threads The maximum number of threads, or 0 for
+ * std::thread::hardware_concurrency().
+ * @param decode_slab Decodes a range and returns its number of failures.
+ * @return The total number of failures.
+ */
+template <typename SlabFn>
+[[nodiscard]] std::size_t DecodeSlabs(std::size_t count,
+                                      std::size_t max_threads,
+                                      const SlabFn& decode_slab) {
+    if (max_threads == 0) {
+        max_threads =
+            std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    const std::size_t slabs = std::min(max_threads, count);
+    if (slabs <= 1) {
+        return decode_slab(std::size_t{0}, count);
+    }
+
+    std::vector<std::size_t> failed(slabs, 0);
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(slabs - 1);
+        for (std::size_t s = 1; s < slabs; ++s) {
+            workers.emplace_back([&, s] {
+                failed[s] =
+                    decode_slab(count * s / slabs, count * (s + 1) / slabs);
+            });
+        }
+        failed[0] = decode_slab(std::size_t{0}, count / slabs);
+    }
+    return std::accumulate(failed.begin(), failed.end(), std::size_t{0});
+}
+
+}  // namespace detail
+
+/**
+ * @brief Deserializes a batch of frames across multiple threads.
+ *
+ * Produces the same `out` and `errors` as DeserializeBatch. The frames are
+ * split into one contiguous slab per thread, and each thread writes only
+ * its own slab of `out` and `errors`.
+ *
+ * Throws std::system_error if a thread cannot be started.
+ *
+ * @tparam Message The CrunchMessage type to deserialize into.
+ * @tparam Integrity The IntegrityPolicy the frames were written with.
+ * @tparam Serdes The SerdesPolicy the frames were written with.
+ * @param frames The serialized messages, each including its checksum.
+ * @param out Receives the message decoded from each frame.
+ * @param errors Receives std::nullopt or the Error for each frame.
+ * @param max_threads The maximum number of threads, or 0 for
+ * std::thread::hardware_concurrency().
+ * @return The number of frames that failed, or an Error if `out` or `errors`
+ * is smaller than `frames`.
+ */
+template <messages::CrunchMessage Message, typename Integrity, typename Serdes>
+    requires IntegrityPolicy<Integrity> && SerdesPolicy<Serdes, Message>
+[[nodiscard]] auto DeserializeBatchParallel(
+    std::span<const std::span<const std::byte>> frames, std::span<Message> out,
+    std::span<std::optional<Error>> errors, std::size_t max_threads = 0)
+    -> std::expected<std::size_t, Error> {
+    if (out.size() < frames.size() || errors.size() < frames.size()) {
+        return std::unexpected(
+            Error::capacity_exceeded(0, "output smaller than batch"));
+    }
+    return detail::DecodeSlabs(
+        frames.size(), max_threads,
+        [&](std::size_t begin, std::size_t end) -> std::size_t {
+            const std::size_t n = end - begin;
+            return detail::DeserializeBatch<Integrity, Serdes>(
+                       frames.subspan(begin, n), out.subspan(begin, n),
+                       errors.subspan(begin, n))
+                .value_or(0);
+        });
+}
+
+/**
+ * @brief Decodes a batch of mixed-type frames across multiple threads.
+ *
+ * Produces the same `out` and `errors` as Decoder::DecodeBatch. Each thread
+ * uses its own DecoderType and writes only its own slab of `out` and
+ * `errors`.
+ *
+ * Throws std::system_error if a thread cannot be started.
+ *
+ * @tparam DecoderType The Decoder type
+ * @param frames The serialized messages, each including its checksum.
+ * @param out Receives the message decoded from each frame.
+ * @param errors Receives std::nullopt or the Error for each frame.
+ * @param max_threads The maximum number of threads, or 0 for
+ * std::thread::hardware_concurrency().
+ * @return The number of frames that failed, or an Error if `out` or `errors`
+ * is smaller than `frames`.
+ */
+template <typename DecoderType>
+    requires IsDecoder<DecoderType>
+[[nodiscard]] auto DecodeBatchParallel(
+    std::span<const std::span<const std::byte>> frames,
+    std::span<typename DecoderType::VariantType> out,
+    std::span<std::optional<Error>> errors, std::size_t max_threads = 0)
+    -> std::expected<std::size_t, Error> {
+    if (out.size() < frames.size() || errors.size() < frames.size()) {
+        return std::unexpected(
+            Error::capacity_exceeded(0, "output smaller than batch"));
+    }
+    return detail::DecodeSlabs(
+        frames.size(), max_threads,
+        [&](std::size_t begin, std::size_t end) -> std::size_t {
+            const std::size_t n = end - begin;
+            DecoderType decoder;
+            return decoder
+                .DecodeBatch(frames.subspan(begin, n), out.subspan(begin, n),
+                             errors.subspan(begin, n))
+                .value_or(0);
+        });
+}
+
+}  // namespace Crunch
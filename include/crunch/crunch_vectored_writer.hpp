@@ -0,0 +1,243 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <crunch/crunch.hpp>
+#include <cstddef>
+#include <expected>
+#include <span>
+#include <system_error>
+
+/**
+ * @brief Batched frame output with one gathering write per batch.
+ *
+ * Kept out of crunch.hpp since it needs POSIX <sys/uio.h> and
+ * <sys/socket.h>.
+ */
+namespace Crunch {
+
+/**
+ * @brief When a VectoredWriter flushes its batch on its own.
+ */
+struct VectoredWriterConfig {
+    /// Flush once this many bytes are queued.
+    std::size_t max_bytes{64 * 1024};
+    /// Flush once the oldest queued frame has waited this long.
+    std::chrono::steady_clock::duration max_latency{
+        std::chrono::microseconds{100}};
+};
+
+/**
+ * @brief Gathers serialized frames and writes each batch to a file
+ * descriptor with a single writev (or, for sockets, sendmsg) call.
+ *
+ * Frames are queued by reference, not copied: the bytes behind each span
+ * must stay valid until a flush has written them. A batch is flushed when
+ * MaxFrames frames or VectoredWriterConfig::max_bytes bytes are queued, or
+ * when Add or Poll finds that the oldest frame has waited longer than
+ * VectoredWriterConfig::max_latency. Flush writes whatever is queued.
+ *
+ * Short writes are resumed where they stopped. Like write(2), a flush that
+ * fails after writing some bytes returns that count; the unwritten frames
+ * stay queued and the next flush reports the error (e.g. EAGAIN once a
+ * non-blocking descriptor fills up). The writer does not own the descriptor.
+ *
+ * Sockets are written with sendmsg and MSG_NOSIGNAL, so a closed peer makes
+ * a flush return EPIPE instead of raising SIGPIPE. Pipes, and sockets on
+ * platforms without MSG_NOSIGNAL, are written with writev and still raise
+ * SIGPIPE when the reader has gone; callers writing to those must ignore
+ * SIGPIPE (or set SO_NOSIGPIPE) to see EPIPE instead.
+ *
+ * @tparam MaxFrames The most frames in one batch, at most IOV_MAX.
+ */
+template <std::size_t MaxFrames = 64>
+class VectoredWriter {
+    static_assert(MaxFrames > 0, "VectoredWriter needs room for a frame.");
+    static_assert(MaxFrames <= IOV_MAX,
+                  "VectoredWriter batches are limited to IOV_MAX frames.");
+
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Creates a writer for a file, pipe or socket.
+     * @param fd The descriptor to write to.
+     * @param config When to flush without an explicit Flush.
+     */
+    explicit VectoredWriter(int fd, VectoredWriterConfig config = {}) noexcept
+        : fd_(fd), is_socket_(is_socket(fd)), config_(config) {}
+
+    /**
+     * @brief Queues a frame, flushing if that completes a batch.
+     *
+     * @param frame The frame, e.g. Buffer::serialized_message_span().
+     * @return The number of bytes written by this call (0 if the frame was
+     * only queued), or an error. std::errc::no_buffer_space means an earlier
+     * failed flush left the batch full and the frame was not queued; call
+     * Flush once the descriptor is writable. Any other error comes from
+     * the write, and the frame stays queued.
+     */
+    [[nodiscard]] auto Add(std::span<const std::byte> frame) noexcept
+        -> std::expected<std::size_t, std::error_code> {
+        if (end_ == MaxFrames) {
+            return std::unexpected(
+                std::make_error_code(std::errc::no_buffer_space));
+        }
+        if (frame.empty()) {
+            return std::size_t{0};
+        }
+
+        if (begin_ == end_) {
+            oldest_ = Clock::now();
+        }
+        // writev and sendmsg do not modify the bytes, they just take a
+        // non-const pointer.
+        iov_[end_++] = {const_cast<std::byte*>(frame.data()), frame.size()};
+        queued_bytes_ += frame.size();
+
+        if (end_ == MaxFrames || queued_bytes_ >= config_.max_bytes ||
+            Clock::now() >= Deadline()) {
+            return Flush();
+        }
+        return std::size_t{0};
+    }
+
+    /**
+     * @brief Queues the serialized frame held by a Buffer.
+     * @param buffer The buffer, which must outlive the flush.
+     * @return As Add(std::span).
+     */
+    template <typename BufferType>
+        requires IsBuffer<BufferType>
+    [[nodiscard]] auto Add(const BufferType& buffer) noexcept
+        -> std::expected<std::size_t, std::error_code> {
+        return Add(buffer.serialized_message_span());
+    }
+
+    /**
+     * @brief Flushes the batch if its oldest frame has waited longer than
+     * max_latency. Call this from an event loop timer, see Deadline.
+     * @return The number of bytes written, or the error from the write.
+     */
+    [[nodiscard]] auto Poll() noexcept
+        -> std::expected<std::size_t, std::error_code> {
+        if (begin_ == end_ || Clock::now() < Deadline()) {
+            return std::size_t{0};
+        }
+        return Flush();
+    }
+
+    /**
+     * @brief Writes every queued frame.
+     *
+     * Retries on EINTR and resumes after short writes. On any other error
+     * the unwritten frames stay queued. If bytes were written before the
+     * error, their count is returned and the error is left for the next call.
+     *
+     * @return The number of bytes written, or the error from the write when
+     * nothing was written, e.g. std::errc::broken_pipe once a socket's peer
+     * has closed.
+     */
+    [[nodiscard]] auto Flush() noexcept
+        -> std::expected<std::size_t, std::error_code> {
+        std::size_t written = 0;
+        while (begin_ != end_) {
+            const ssize_t n = write_queued();
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                const std::error_code error{errno, std::system_category()};
+                compact();
+                if (written > 0) {
+                    return written;
+                }
+                return std::unexpected(error);
+            }
+            written += static_cast<std::size_t>(n);
+            advance(static_cast<std::size_t>(n));
+        }
+        begin_ = 0;
+        end_ = 0;
+        return written;
+    }
+
+    /// The time by which Poll flushes the queued frames.
+    [[nodiscard]] Clock::time_point Deadline() const noexcept {
+        return oldest_ + config_.max_latency;
+    }
+
+    /// The number of frames waiting to be written.
+    [[nodiscard]] std::size_t pending() const noexcept {
+        return end_ - begin_;
+    }
+
+    /// The number of bytes waiting to be written.
+    [[nodiscard]] std::size_t pending_bytes() const noexcept {
+        return queued_bytes_;
+    }
+
+   private:
+    /// Whether fd refers to a socket, which sendmsg can write without SIGPIPE.
+    [[nodiscard]] static bool is_socket(int fd) noexcept {
+        struct stat st;
+        return ::fstat(fd, &st) == 0 && S_ISSOCK(st.st_mode);
+    }
+
+    /// Writes as much of the queue as the descriptor takes in one call.
+    [[nodiscard]] ssize_t write_queued() noexcept {
+#ifdef MSG_NOSIGNAL
+        if (is_socket_) {
+            msghdr msg{};
+            msg.msg_iov = iov_.data() + begin_;
+            msg.msg_iovlen =
+                static_cast<decltype(msg.msg_iovlen)>(end_ - begin_);
+            return ::sendmsg(fd_, &msg, MSG_NOSIGNAL);
+        }
+#endif
+        return ::writev(fd_, iov_.data() + begin_,
+                        static_cast<int>(end_ - begin_));
+    }
+
+    /// Drops `count` written bytes from the front of the queue.
+    void advance(std::size_t count) noexcept {
+        queued_bytes_ -= count;
+        while (count > 0 && count >= iov_[begin_].iov_len) {
+            count -= iov_[begin_].iov_len;
+            ++begin_;
+        }
+        if (count > 0) {
+            // A short write stopped inside this frame.
+            iov_[begin_].iov_base =
+                static_cast<std::byte*>(iov_[begin_].iov_base) + count;
+            iov_[begin_].iov_len -= count;
+        }
+    }
+
+    /// Moves the unwritten frames to the front so new ones can be queued.
+    void compact() noexcept {
+        std::copy(iov_.begin() + static_cast<std::ptrdiff_t>(begin_),
+                  iov_.begin() + static_cast<std::ptrdiff_t>(end_),
+                  iov_.begin());
+        end_ -= begin_;
+        begin_ = 0;
+    }
+
+    int fd_;
+    bool is_socket_;
+    VectoredWriterConfig config_;
+    std::array<iovec, MaxFrames> iov_{};
+    std::size_t begin_{0};
+    std::size_t end_{0};
+    std::size_t queued_bytes_{0};
+    Clock::time_point oldest_{};
+};
+
+}  // namespace Crunch
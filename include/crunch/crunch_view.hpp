@@ -0,0 +1,445 @@
+#pragma once
+
+#include <concepts>
+#include <crunch/core/crunch_endian.hpp>
+#include <crunch/core/crunch_header.hpp>
+#include <crunch/core/crunch_types.hpp>
+#include <crunch/crunch_detail.hpp>
+#include <crunch/fields/crunch_string.hpp>
+#include <crunch/integrity/crunch_integrity.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_serdes.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Crunch {
+
+template <messages::CrunchMessage Message, typename Serdes>
+    requires InPlaceSerdesPolicy<Serdes, Message>
+class View;
+
+template <typename Array, typename Serdes>
+class ArrayView;
+
+template <typename Map, typename Serdes>
+class MapView;
+
+namespace detail {
+
+/**
+ * @brief Reads and checks values in place on behalf of View, ArrayView and
+ * MapView.
+ *
+ * Offsets are absolute positions in the payload span, so alignment padding
+ * is computed exactly as the Serdes policy wrote it.
+ */
+struct ViewAccess {
+    /**
+     * @brief Opens a view of a payload whose integrity and header are valid.
+     *
+     * Checks the payload size, then every length prefix and nested MessageId
+     * against the message definition, so the view's accessors never read
+     * out of bounds.
+     *
+     * @tparam Message The message type.
+     * @tparam Serdes The serialization policy.
+     * @param payload The payload, including the header.
+     * @return The view, or an Error.
+     */
+    template <typename Message, typename Serdes>
+    [[nodiscard]] static constexpr auto open(
+        std::span<const std::byte> payload) noexcept
+        -> std::expected<View<Message, Serdes>, Error> {
+        if (payload.size() < Serdes::template Size<Message>()) {
+            return std::unexpected(
+                Error::deserialization("buffer too small for message"));
+        }
+        const std::size_t fields_offset = Serdes::PayloadOffset();
+        if (auto err = check_fields<Message, Serdes>(payload, fields_offset);
+            err.has_value()) {
+            return std::unexpected(*err);
+        }
+        return View<Message, Serdes>{payload, fields_offset};
+    }
+
+    /**
+     * @brief Reads a value.
+     * @tparam T The value type.
+     * @tparam Serdes The serialization policy.
+     * @param input The payload.
+     * @param offset The offset the value starts at.
+     * @return - Scalars: The value.
+     * @return - Strings: A std::string_view into the payload.
+     * @return - Messages: A View of the submessage.
+     * @return - Arrays/Maps: An ArrayView/MapView.
+     */
+    template <typename T, typename Serdes>
+    [[nodiscard]] static constexpr auto read_value(
+        std::span<const std::byte> input, std::size_t offset) noexcept {
+        const std::size_t at = Serdes::template ValueOffset<T>(offset);
+        if constexpr (fields::is_string_v<T>) {
+            const auto len = load<uint32_t>(input, at);
+            return std::string_view{
+                reinterpret_cast<const char*>(input.data() + at +
+                                              sizeof(uint32_t)),
+                len};
+        } else if constexpr (messages::CrunchMessage<T>) {
+            return View<T, Serdes>{input, at + sizeof(MessageId)};
+        } else if constexpr (messages::is_array_field_v<T>) {
+            return ArrayView<T, Serdes>{input, at + sizeof(uint32_t),
+                                        load<uint32_t>(input, at)};
+        } else if constexpr (messages::is_map_field_v<T>) {
+            return MapView<T, Serdes>{input, at + sizeof(uint32_t),
+                                      load<uint32_t>(input, at)};
+        } else {
+            return load<typename T::ValueType>(input, at);
+        }
+    }
+
+    /**
+     * @brief Checks that a value's length prefixes and MessageIds are valid.
+     * @tparam T The value type.
+     * @tparam Serdes The serialization policy.
+     * @param input The payload.
+     * @param offset The offset the value starts at.
+     * @return std::nullopt if the value can be read, or an Error.
+     */
+    template <typename T, typename Serdes>
+    [[nodiscard]] static constexpr auto check_value(
+        std::span<const std::byte> input, std::size_t offset) noexcept
+        -> std::optional<Error> {
+        const std::size_t at = Serdes::template ValueOffset<T>(offset);
+        if constexpr (fields::is_string_v<T>) {
+            if (load<uint32_t>(input, at) > T::max_size) {
+                return Error::capacity_exceeded(
+                    0, "deserialized string too long");
+            }
+        } else if constexpr (messages::CrunchMessage<T>) {
+            if (load<MessageId>(input, at) != T::message_id) {
+                return Error::invalid_message_id();
+            }
+            return check_fields<T, Serdes>(input, at + sizeof(MessageId));
+        } else if constexpr (messages::is_array_field_v<T>) {
+            using Element = typename T::ValueType;
+            const auto len = load<uint32_t>(input, at);
+            if (len > T::max_size) {
+                return Error::capacity_exceeded(0, "array capacity exceeded");
+            }
+            if constexpr (!fields::is_scalar_v<Element>) {
+                const std::size_t first = at + sizeof(uint32_t);
+                for (std::size_t i = 0; i < len; ++i) {
+                    const std::size_t element =
+                        Serdes::template ElementOffset<Element>(first, i);
+                    if (auto err = check_value<Element, Serdes>(input, element);
+                        err.has_value()) {
+                        return err;
+                    }
+                }
+            }
+        } else if constexpr (messages::is_map_field_v<T>) {
+            using Key = typename T::PairType::first_type;
+            using Value = typename T::PairType::second_type;
+            const auto len = load<uint32_t>(input, at);
+            if (len > T::max_size) {
+                return Error::capacity_exceeded(0, "map capacity exceeded");
+            }
+            if constexpr (!fields::is_scalar_v<Key> ||
+                          !fields::is_scalar_v<Value>) {
+                const std::size_t first = at + sizeof(uint32_t);
+                for (std::size_t i = 0; i < len; ++i) {
+                    const std::size_t key =
+                        Serdes::template ElementOffset<Key, Value>(first, i);
+                    const std::size_t value =
+                        Serdes::template ValueEndOffset<Key>(key);
+                    if (auto err = check_value<Key, Serdes>(input, key);
+                        err.has_value()) {
+                        return err;
+                    }
+                    if (auto err = check_value<Value, Serdes>(input, value);
+                        err.has_value()) {
+                        return err;
+                    }
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Checks every field of a message.
+     * @tparam Message The message type.
+     * @tparam Serdes The serialization policy.
+     * @param input The payload.
+     * @param fields_offset The offset of the message's first field.
+     * @return std::nullopt if the message can be read, or an Error.
+     */
+    template <typename Message, typename Serdes>
+    [[nodiscard]] static constexpr auto check_fields(
+        std::span<const std::byte> input, std::size_t fields_offset) noexcept
+        -> std::optional<Error> {
+        using Fields = std::remove_cvref_t<
+            decltype(std::declval<Message&>().get_fields())>;
+        std::optional<Error> err;
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ([&] {
+                using F = std::remove_cvref_t<std::tuple_element_t<Is, Fields>>;
+                const std::size_t offset =
+                    Serdes::template FieldOffset<Message, Is>(fields_offset);
+                if constexpr (messages::is_array_field_v<F> ||
+                              messages::is_map_field_v<F>) {
+                    err = check_value<F, Serdes>(input, offset);
+                } else if constexpr (!fields::is_scalar_v<
+                                         typename F::FieldType>) {
+                    if (static_cast<bool>(input[offset])) {
+                        err = check_value<typename F::FieldType, Serdes>(
+                            input, offset + 1);
+                    }
+                }
+                return !err.has_value();
+            }() &&
+             ...);
+        }(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+        return err;
+    }
+
+   private:
+    template <typename T>
+    [[nodiscard]] static constexpr T load(std::span<const std::byte> input,
+                                          std::size_t at) noexcept {
+        T le_value;
+        std::memcpy(&le_value, input.data() + at, sizeof(T));
+        return Crunch::LittleEndian(le_value);
+    }
+};
+
+/// What reading a value of type T in place yields.
+template <typename T, typename Serdes>
+using ViewValue = decltype(ViewAccess::read_value<T, Serdes>(
+    std::declval<std::span<const std::byte>>(), std::size_t{}));
+
+}  // namespace detail
+
+/**
+ * @brief A read-only view of a serialized message that decodes nothing up
+ * front.
+ *
+ * Created by GetView(), which verifies integrity, the header, and every
+ * length prefix and nested MessageId once. Each get<Id>() then reads the
+ * field straight out of the buffer at an offset the Serdes policy computes
+ * in constant time, so reading a few fields of a large message only touches
+ * those fields.
+ *
+ * The view borrows the buffer, which must outlive it and stay unchanged.
+ * Field and message validators are not run; use Deserialize when they are
+ * needed.
+ *
+ * @tparam Message The CrunchMessage type in the buffer.
+ * @tparam Serdes The InPlaceSerdesPolicy the buffer was written with.
+ */
+template <messages::CrunchMessage Message, typename Serdes>
+    requires InPlaceSerdesPolicy<Serdes, Message>
+class View {
+   public:
+    using MessageType = Message;
+    using SerdesType = Serdes;
+
+    /**
+     * @brief Reads a field.
+     * @tparam Id The field's FieldId.
+     * @return - Scalars: std::optional<ValueType> (nullopt if unset).
+     * @return - Strings: std::optional<std::string_view> (nullopt if unset).
+     * @return - Messages: std::optional<View> (nullopt if unset).
+     * @return - Arrays/Maps: An ArrayView/MapView.
+     */
+    template <FieldId Id>
+    [[nodiscard]] constexpr auto get() const noexcept {
+        constexpr std::size_t Index = messages::field_index_v<Message, Id>;
+        static_assert(Index < std::tuple_size_v<Fields>,
+                      "Message has no field with this FieldId");
+        using F = std::remove_cvref_t<std::tuple_element_t<Index, Fields>>;
+
+        const std::size_t offset =
+            Serdes::template FieldOffset<Message, Index>(fields_offset_);
+        if constexpr (messages::is_array_field_v<F> ||
+                      messages::is_map_field_v<F>) {
+            return detail::ViewAccess::read_value<F, Serdes>(input_, offset);
+        } else {
+            using T = typename F::FieldType;
+            auto ret = std::optional<detail::ViewValue<T, Serdes>>{};
+            if (static_cast<bool>(input_[offset])) {
+                ret.emplace(detail::ViewAccess::read_value<T, Serdes>(
+                    input_, offset + 1));
+            }
+            return ret;
+        }
+    }
+
+   private:
+    using Fields = std::remove_cvref_t<
+        decltype(std::declval<Message&>().get_fields())>;
+
+    constexpr View(std::span<const std::byte> input,
+                   std::size_t fields_offset) noexcept
+        : input_(input), fields_offset_(fields_offset) {}
+
+    std::span<const std::byte> input_;
+    std::size_t fields_offset_;
+
+    friend struct detail::ViewAccess;
+};
+
+/**
+ * @brief A read-only view of a serialized ArrayField.
+ * @tparam Array The ArrayField type.
+ * @tparam Serdes The InPlaceSerdesPolicy the buffer was written with.
+ */
+template <typename Array, typename Serdes>
+class ArrayView {
+    using Element = typename Array::ValueType;
+
+   public:
+    /**
+     * @brief Get the number of elements.
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief Check if the array is empty.
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Read the element at index (unchecked) in constant time.
+     * @return The element's value, std::string_view, or View.
+     */
+    [[nodiscard]] constexpr auto operator[](std::size_t index) const noexcept {
+        return detail::ViewAccess::read_value<Element, Serdes>(
+            input_, Serdes::template ElementOffset<Element>(first_, index));
+    }
+
+   private:
+    constexpr ArrayView(std::span<const std::byte> input, std::size_t first,
+                        std::size_t size) noexcept
+        : input_(input), first_(first), size_(size) {}
+
+    std::span<const std::byte> input_;
+    std::size_t first_;
+    std::size_t size_;
+
+    friend struct detail::ViewAccess;
+};
+
+/**
+ * @brief A read-only view of a serialized MapField.
+ * @tparam Map The MapField type.
+ * @tparam Serdes The InPlaceSerdesPolicy the buffer was written with.
+ */
+template <typename Map, typename Serdes>
+class MapView {
+    using Key = typename Map::PairType::first_type;
+    using Value = typename Map::PairType::second_type;
+
+   public:
+    /**
+     * @brief Get the number of entries.
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief Check if the map is empty.
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Read the key of the entry at index (unchecked).
+     */
+    [[nodiscard]] constexpr auto key(std::size_t index) const noexcept {
+        return detail::ViewAccess::read_value<Key, Serdes>(input_,
+                                                           key_offset(index));
+    }
+
+    /**
+     * @brief Read the value of the entry at index (unchecked).
+     */
+    [[nodiscard]] constexpr auto value(std::size_t index) const noexcept {
+        return detail::ViewAccess::read_value<Value, Serdes>(
+            input_, Serdes::template ValueEndOffset<Key>(key_offset(index)));
+    }
+
+    /**
+     * @brief Find the value for a key.
+     * @param key The key to look up.
+     * @return The value, or std::nullopt if the key is not present.
+     */
+    template <typename K>
+        requires std::equality_comparable_with<
+            detail::ViewValue<Key, Serdes>, const K&>
+    [[nodiscard]] constexpr auto at(const K& key_to_find) const noexcept
+        -> std::optional<detail::ViewValue<Value, Serdes>> {
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (key(i) == key_to_find) {
+                return value(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+   private:
+    constexpr MapView(std::span<const std::byte> input, std::size_t first,
+                      std::size_t size) noexcept
+        : input_(input), first_(first), size_(size) {}
+
+    [[nodiscard]] constexpr std::size_t key_offset(
+        std::size_t index) const noexcept {
+        return Serdes::template ElementOffset<Key, Value>(first_, index);
+    }
+
+    std::span<const std::byte> input_;
+    std::size_t first_;
+    std::size_t size_;
+
+    friend struct detail::ViewAccess;
+};
+
+namespace detail {
+
+/**
+ * @brief implementation of GetView.
+ *
+ * Verifies integrity and the header, then lets the view check the payload's
+ * structure once.
+ *
+ * @tparam Integrity The integrity policy to use.
+ * @tparam Serdes The serialization policy to use.
+ * @tparam Message The message type in the buffer.
+ * @param buffer The buffer to view.
+ * @return The view, or an Error if integrity or the header is invalid.
+ */
+template <typename Integrity, typename Serdes, typename Message>
+    requires IntegrityPolicy<Integrity> &&
+             InPlaceSerdesPolicy<Serdes, Message> &&
+             messages::CrunchMessage<Message>
+[[nodiscard]] auto MakeView(std::span<const std::byte> buffer) noexcept
+    -> std::expected<View<Message, Serdes>, Error> {
+    const auto payload_result = VerifyIntegrity<Integrity>(buffer);
+    if (!payload_result) {
+        return std::unexpected(payload_result.error());
+    }
+    if (auto header_result = ValidateHeader<Message, Serdes>(*payload_result);
+        !header_result) {
+        return std::unexpected(header_result.error());
+    }
+    return ViewAccess::open<Message, Serdes>(*payload_result);
+}
+
+}  // namespace detail
+
+}  // namespace Crunch
@@ -4,11 +4,25 @@
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <numeric>
 #include <span>
 #include <type_traits>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+/**
+ * @brief Set when x86-64 CRC/carry-less multiply intrinsics can be used for
+ * runtime-dispatched integrity fast paths.
+ */
+#define CRUNCH_X86_INTRINSICS 1
+#else
+#define CRUNCH_X86_INTRINSICS 0
+#endif
+
+#include <crunch/integrity/crunch_xxh3.hpp>
+
 namespace Crunch {
 
 /**
@@ -36,6 +50,52 @@ concept IntegrityPolicy = requires(std::span<const std::byte> data) {
     } -> std::same_as<std::array<std::byte, Policy::size()>>;
 };
 
+/**
+ * @brief Concept for integrity policies that can be computed incrementally.
+ *
+ * Refines IntegrityPolicy with a running state. Implementations must provide:
+ * - `State`: The running checksum state type.
+ * - `init()`: Returns the initial state.
+ * - `update(state, chunk)`: Folds a chunk of bytes into the state.
+ * - `finalize(state)`: Produces the checksum bytes from the state.
+ *
+ * Folding consecutive chunks must produce the same checksum as `calculate`
+ * over their concatenation. Serialization uses this to checksum each region
+ * of the buffer as it is written, instead of making a second pass.
+ */
+template <typename Policy>
+concept IncrementalIntegrityPolicy =
+    IntegrityPolicy<Policy> && requires(std::span<const std::byte> data) {
+        typename Policy::State;
+        { Policy::init() } -> std::same_as<typename Policy::State>;
+        {
+            Policy::update(Policy::init(), data)
+        } -> std::same_as<typename Policy::State>;
+        {
+            Policy::finalize(Policy::init())
+        } -> std::same_as<std::array<std::byte, Policy::size()>>;
+    };
+
+/**
+ * @brief Concept for integrity policies whose checksum can be updated when a
+ * few bytes of the data change, without reading the rest.
+ *
+ * Implementations must provide `patch(checksum, old_bytes, new_bytes,
+ * trailing)`. Given the checksum of some data, it returns the checksum after
+ * `old_bytes` are overwritten by the equally long `new_bytes`, where
+ * `trailing` is the number of data bytes after them. The cost depends on the
+ * changed bytes, not on the size of the data.
+ */
+template <typename Policy>
+concept PatchableIntegrityPolicy =
+    IntegrityPolicy<Policy> &&
+    requires(const std::array<std::byte, Policy::size()>& checksum,
+             std::span<const std::byte> data, std::size_t trailing) {
+        {
+            Policy::patch(checksum, data, data, trailing)
+        } -> std::same_as<std::array<std::byte, Policy::size()>>;
+    };
+
 /**
  * @brief Integrity policies for verifying message correctness.
  */
@@ -52,16 +112,203 @@ struct None {
         std::span<const std::byte>) noexcept -> std::array<std::byte, 0> {
         return {};
     }
+    [[nodiscard]] static constexpr auto patch(
+        const std::array<std::byte, 0>&, std::span<const std::byte>,
+        std::span<const std::byte>, std::size_t) noexcept
+        -> std::array<std::byte, 0> {
+        return {};
+    }
+};
+
+/// @cond INTERNAL
+namespace detail {
+
+/**
+ * @brief Number of lookup tables used by the slice-by-N CRC16 engine.
+ */
+inline constexpr std::size_t CRC16SliceCount = 8;
+
+/**
+ * @brief Generates the slice-by-8 lookup tables for CRC-16-CCITT.
+ *
+ * Table 0 is the classic byte-at-a-time table: the register contribution of a
+ * single input byte. Table k holds the contribution of a byte that is followed
+ * by k further zero bytes, which lets the engine fold 8 input bytes with 8
+ * independent lookups.
+ *
+ * @return The lookup tables, indexed as [slice][byte].
+ */
+consteval auto MakeCRC16Tables() noexcept
+    -> std::array<std::array<uint16_t, 256>, CRC16SliceCount> {
+    std::array<std::array<uint16_t, 256>, CRC16SliceCount> tables{};
+    for (std::size_t i = 0; i < 256; ++i) {
+        auto crc = static_cast<uint16_t>(i << 8);
+        for (int bit = 0; bit < 8; ++bit) {
+            if (crc & 0x8000) {
+                crc = static_cast<uint16_t>((crc << 1) ^ 0x1021);
+            } else {
+                crc = static_cast<uint16_t>(crc << 1);
+            }
+        }
+        tables[0][i] = crc;
+    }
+    for (std::size_t k = 1; k < CRC16SliceCount; ++k) {
+        for (std::size_t i = 0; i < 256; ++i) {
+            const uint16_t prev = tables[k - 1][i];
+            tables[k][i] =
+                static_cast<uint16_t>((prev << 8) ^ tables[0][prev >> 8]);
+        }
+    }
+    return tables;
+}
+
+inline constexpr auto CRC16Tables = MakeCRC16Tables();
+
+/**
+ * @brief Writes a checksum register as big-endian bytes.
+ */
+template <typename T>
+[[nodiscard]] constexpr auto ToBigEndianBytes(T value) noexcept
+    -> std::array<std::byte, sizeof(T)> {
+    std::array<std::byte, sizeof(T)> out{};
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        out[i] = static_cast<std::byte>(
+            (value >> (8 * (sizeof(T) - 1 - i))) & 0xFF);
+    }
+    return out;
+}
+
+/**
+ * @brief Polynomial arithmetic modulo a CRC generator.
+ *
+ * A CRC register is a polynomial over GF(2), so appending n zero bytes to
+ * the data multiplies it by x^(8n). Patching uses this to move the CRC of
+ * the changed bytes past the unchanged bytes that follow them in
+ * O(log n) multiplications instead of feeding n zeros through the register.
+ *
+ * @tparam T The register type.
+ * @tparam Poly The generator polynomial, bit-reflected if Reflected is set.
+ * @tparam Reflected Whether the register is LSB-first.
+ */
+template <typename T, T Poly, bool Reflected>
+struct CRCAlgebra {
+    static constexpr std::size_t Bits = 8 * sizeof(T);
+
+    /**
+     * @brief Returns the coefficient of x^i in a.
+     */
+    [[nodiscard]] static constexpr bool coefficient(T a,
+                                                    std::size_t i) noexcept {
+        return ((Reflected ? a >> (Bits - 1 - i) : a >> i) & 1) != 0;
+    }
+
+    /**
+     * @brief Multiplies a by x modulo the generator.
+     */
+    [[nodiscard]] static constexpr T times_x(T a) noexcept {
+        if constexpr (Reflected) {
+            return (a & 1) ? static_cast<T>((a >> 1) ^ Poly)
+                           : static_cast<T>(a >> 1);
+        } else {
+            return coefficient(a, Bits - 1) ? static_cast<T>((a << 1) ^ Poly)
+                                            : static_cast<T>(a << 1);
+        }
+    }
+
+    /**
+     * @brief Multiplies a by b modulo the generator.
+     */
+    [[nodiscard]] static constexpr T multiply(T a, T b) noexcept {
+        T product = 0;
+        for (std::size_t i = 0; i < Bits; ++i) {
+            if (coefficient(a, i)) {
+                product = static_cast<T>(product ^ b);
+            }
+            b = times_x(b);
+        }
+        return product;
+    }
+
+    /// x^(8 * 2^k) modulo the generator, for k < 64.
+    static constexpr auto ZeroBytePowers = [] {
+        std::array<T, 64> powers{};
+        T x8 = Reflected ? static_cast<T>(T{1} << (Bits - 1)) : T{1};
+        for (int i = 0; i < 8; ++i) {
+            x8 = times_x(x8);
+        }
+        powers[0] = x8;
+        for (std::size_t k = 1; k < powers.size(); ++k) {
+            powers[k] = multiply(powers[k - 1], powers[k - 1]);
+        }
+        return powers;
+    }();
+
+    /**
+     * @brief Advances a register past n zero bytes.
+     * @param crc The register value.
+     * @param n The number of zero bytes.
+     * @return crc * x^(8n) modulo the generator.
+     */
+    [[nodiscard]] static constexpr T shift(T crc, std::size_t n) noexcept {
+        for (std::size_t k = 0; n != 0; ++k, n >>= 1) {
+            if (n & 1) {
+                crc = multiply(crc, ZeroBytePowers[k]);
+            }
+        }
+        return crc;
+    }
 };
 
+/**
+ * @brief Patches a CRC whose register is linear in the data.
+ *
+ * For two inputs of equal length, the init value and final XOR cancel out,
+ * so the checksums differ by the zero-init CRC of the changed bytes,
+ * advanced past the bytes after them.
+ *
+ * @tparam Policy The CRC policy, providing State and update().
+ * @tparam Algebra The CRCAlgebra for the policy's generator.
+ * @param checksum The checksum before the change, as big-endian bytes.
+ * @param old_bytes The bytes before the change.
+ * @param new_bytes The bytes after the change.
+ * @param trailing The number of data bytes after the changed bytes.
+ * @return The checksum after the change.
+ */
+template <typename Policy, typename Algebra>
+[[nodiscard]] constexpr auto PatchCRC(
+    const std::array<std::byte, sizeof(typename Policy::State)>& checksum,
+    std::span<const std::byte> old_bytes, std::span<const std::byte> new_bytes,
+    std::size_t trailing) noexcept
+    -> std::array<std::byte, sizeof(typename Policy::State)> {
+    using T = typename Policy::State;
+    T value = 0;
+    for (const std::byte b : checksum) {
+        value = static_cast<T>((value << 8) | static_cast<T>(b));
+    }
+    const T delta = static_cast<T>(Policy::update(T{0}, old_bytes) ^
+                                   Policy::update(T{0}, new_bytes));
+    return ToBigEndianBytes(
+        static_cast<T>(value ^ Algebra::shift(delta, trailing)));
+}
+
+}  // namespace detail
+/// @endcond
+
 /**
  * @brief CRC-16-CCITT integrity policy.
  *
  * Adds 2 bytes of overhead. Uses polynomial 0x1021 with initial value 0xFFFF.
  *
+ * The checksum is computed with a table-driven slice-by-8 engine: 8 bytes are
+ * folded per step using compile-time generated lookup tables, with a
+ * byte-at-a-time table loop for the tail. The tables are `constexpr`, so the
+ * policy remains usable in constant expressions.
+ *
  * @see https://srecord.sourceforge.net/crc16-ccitt.html
  */
 struct CRC16 {
+    using State = uint16_t;
+
     [[nodiscard]] static constexpr std::size_t size() noexcept { return 2; }
 
     /**
@@ -71,20 +318,74 @@ struct CRC16 {
      */
     [[nodiscard]] static constexpr auto calculate(
         std::span<const std::byte> data) noexcept -> std::array<std::byte, 2> {
-        uint16_t crc = 0xFFFF;
-        for (std::byte b : data) {
-            crc ^= (static_cast<uint8_t>(b) << 8);
-            for (int i = 0; i < 8; i++) {
-                if (crc & 0x8000) {
-                    crc = static_cast<uint16_t>((crc << 1) ^ 0x1021);
-                } else {
-                    crc = static_cast<uint16_t>(crc << 1);
-                }
-            }
-        }
+        return finalize(update(init(), data));
+    }
+
+    /**
+     * @brief Returns the initial CRC-16-CCITT register value.
+     */
+    [[nodiscard]] static constexpr State init() noexcept { return 0xFFFF; }
+
+    /**
+     * @brief Converts a register value into checksum bytes.
+     * @param crc The register value.
+     * @return 2-byte array containing the checksum (big-endian).
+     */
+    [[nodiscard]] static constexpr auto finalize(State crc) noexcept
+        -> std::array<std::byte, 2> {
         return {static_cast<std::byte>((crc >> 8) & 0xFF),
                 static_cast<std::byte>(crc & 0xFF)};
     }
+
+    /**
+     * @brief Folds more bytes into a running CRC-16-CCITT register.
+     * @param crc The current register value.
+     * @param data The bytes to fold in.
+     * @return The updated register value.
+     */
+    [[nodiscard]] static constexpr State update(
+        State crc, std::span<const std::byte> data) noexcept {
+        const auto& t = detail::CRC16Tables;
+        const auto byte_at = [&](std::size_t i) {
+            return static_cast<uint8_t>(data[i]);
+        };
+
+        std::size_t i = 0;
+        for (; i + detail::CRC16SliceCount <= data.size();
+             i += detail::CRC16SliceCount) {
+            // The register is folded into the first two bytes of the block.
+            const auto hi = static_cast<uint8_t>(byte_at(i) ^ (crc >> 8));
+            const auto lo = static_cast<uint8_t>(byte_at(i + 1) ^ (crc & 0xFF));
+            crc = static_cast<uint16_t>(
+                t[7][hi] ^ t[6][lo] ^ t[5][byte_at(i + 2)] ^
+                t[4][byte_at(i + 3)] ^ t[3][byte_at(i + 4)] ^
+                t[2][byte_at(i + 5)] ^ t[1][byte_at(i + 6)] ^
+                t[0][byte_at(i + 7)]);
+        }
+        for (; i < data.size(); ++i) {
+            crc = static_cast<uint16_t>((crc << 8) ^
+                                        t[0][(crc >> 8) ^ byte_at(i)]);
+        }
+        return crc;
+    }
+
+    /**
+     * @brief Updates a checksum after some bytes of the data changed.
+     * @param checksum The checksum before the change.
+     * @param old_bytes The bytes before the change.
+     * @param new_bytes The bytes after the change, same length.
+     * @param trailing The number of data bytes after the changed bytes.
+     * @return The checksum after the change.
+     */
+    [[nodiscard]] static constexpr auto patch(
+        const std::array<std::byte, 2>& checksum,
+        std::span<const std::byte> old_bytes,
+        std::span<const std::byte> new_bytes, std::size_t trailing) noexcept
+        -> std::array<std::byte, 2> {
+        using Algebra = detail::CRCAlgebra<uint16_t, 0x1021, false>;
+        return detail::PatchCRC<CRC16, Algebra>(checksum, old_bytes,
+                                                new_bytes, trailing);
+    }
 };
 
 /**
@@ -93,6 +394,8 @@ struct CRC16 {
  * Adds 1 byte of overhead. XORs all bytes together for a simple parity check.
  */
 struct Parity {
+    using State = std::byte;
+
     [[nodiscard]] static constexpr std::size_t size() noexcept { return 1; }
 
     /**
@@ -102,8 +405,456 @@ struct Parity {
      */
     [[nodiscard]] static constexpr auto calculate(
         std::span<const std::byte> data) noexcept -> std::array<std::byte, 1> {
-        return {std::accumulate(data.begin(), data.end(), std::byte{0},
-                                std::bit_xor<std::byte>{})};
+        return finalize(update(init(), data));
+    }
+
+    /**
+     * @brief Returns the initial parity.
+     */
+    [[nodiscard]] static constexpr State init() noexcept {
+        return std::byte{0};
+    }
+
+    /**
+     * @brief Folds more bytes into a running parity.
+     * @param parity The current parity.
+     * @param data The bytes to fold in.
+     * @return The updated parity.
+     */
+    [[nodiscard]] static constexpr State update(
+        State parity, std::span<const std::byte> data) noexcept {
+        return std::accumulate(data.begin(), data.end(), parity,
+                               std::bit_xor<std::byte>{});
+    }
+
+    /**
+     * @brief Converts a running parity into checksum bytes.
+     * @param parity The parity.
+     * @return 1-byte array containing the parity byte.
+     */
+    [[nodiscard]] static constexpr auto finalize(State parity) noexcept
+        -> std::array<std::byte, 1> {
+        return {parity};
+    }
+
+    /**
+     * @brief Updates a parity after some bytes of the data changed.
+     *
+     * XOR is position independent, so `trailing` is unused.
+     *
+     * @param checksum The parity before the change.
+     * @param old_bytes The bytes before the change.
+     * @param new_bytes The bytes after the change, same length.
+     * @return The parity after the change.
+     */
+    [[nodiscard]] static constexpr auto patch(
+        const std::array<std::byte, 1>& checksum,
+        std::span<const std::byte> old_bytes,
+        std::span<const std::byte> new_bytes, std::size_t) noexcept
+        -> std::array<std::byte, 1> {
+        return finalize(update(update(checksum[0], old_bytes), new_bytes));
+    }
+};
+
+/// @cond INTERNAL
+namespace detail {
+
+/**
+ * @brief Generates slice-by-8 lookup tables for a reflected (LSB-first) CRC.
+ *
+ * @tparam T The register type (uint32_t or uint64_t).
+ * @tparam Poly The bit-reflected generator polynomial.
+ * @return The lookup tables, indexed as [slice][byte].
+ */
+template <typename T, T Poly>
+consteval auto MakeReflectedCRCTables() noexcept
+    -> std::array<std::array<T, 256>, 8> {
+    std::array<std::array<T, 256>, 8> tables{};
+    for (std::size_t i = 0; i < 256; ++i) {
+        auto crc = static_cast<T>(i);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? static_cast<T>((crc >> 1) ^ Poly)
+                            : static_cast<T>(crc >> 1);
+        }
+        tables[0][i] = crc;
+    }
+    for (std::size_t k = 1; k < tables.size(); ++k) {
+        for (std::size_t i = 0; i < 256; ++i) {
+            const T prev = tables[k - 1][i];
+            tables[k][i] =
+                static_cast<T>((prev >> 8) ^ tables[0][prev & 0xFF]);
+        }
+    }
+    return tables;
+}
+
+template <typename T, T Poly>
+inline constexpr auto ReflectedCRCTables = MakeReflectedCRCTables<T, Poly>();
+
+/**
+ * @brief Portable slice-by-8 update of a reflected CRC register.
+ *
+ * Usable in constant expressions; this is the fallback for every reflected
+ * CRC policy when no hardware path is available.
+ *
+ * @tparam T The register type (uint32_t or uint64_t).
+ * @tparam Poly The bit-reflected generator polynomial.
+ * @param crc The current register value.
+ * @param data The bytes to fold in.
+ * @return The updated register value.
+ */
+template <typename T, T Poly>
+[[nodiscard]] constexpr T ReflectedCRCUpdate(
+    T crc, std::span<const std::byte> data) noexcept {
+    const auto& t = ReflectedCRCTables<T, Poly>;
+    std::size_t i = 0;
+    for (; i + 8 <= data.size(); i += 8) {
+        uint64_t block = 0;
+        for (std::size_t b = 0; b < 8; ++b) {
+            block |= static_cast<uint64_t>(data[i + b]) << (8 * b);
+        }
+        block ^= crc;
+        crc = static_cast<T>(t[7][block & 0xFF] ^ t[6][(block >> 8) & 0xFF] ^
+                             t[5][(block >> 16) & 0xFF] ^
+                             t[4][(block >> 24) & 0xFF] ^
+                             t[3][(block >> 32) & 0xFF] ^
+                             t[2][(block >> 40) & 0xFF] ^
+                             t[1][(block >> 48) & 0xFF] ^ t[0][block >> 56]);
+    }
+    for (; i < data.size(); ++i) {
+        crc = static_cast<T>((crc >> 8) ^
+                             t[0][(crc ^ static_cast<T>(data[i])) & 0xFF]);
+    }
+    return crc;
+}
+
+/**
+ * @brief Bit-reverses a 64-bit value.
+ */
+[[nodiscard]] consteval uint64_t Reflect64(uint64_t value) noexcept {
+    uint64_t out = 0;
+    for (int i = 0; i < 64; ++i) {
+        out = (out << 1) | ((value >> i) & 1);
+    }
+    return out;
+}
+
+/**
+ * @brief Computes x^n mod P for a degree-64 generator, bit-reflected.
+ *
+ * These are the folding constants for the carry-less multiply CRC64 path.
+ *
+ * @param n The exponent.
+ * @param reflected_poly The bit-reflected generator polynomial (without the
+ * x^64 term).
+ * @return The remainder in bit-reflected form.
+ */
+[[nodiscard]] consteval uint64_t ReflectedXPowMod64(
+    std::size_t n, uint64_t reflected_poly) noexcept {
+    const uint64_t poly = Reflect64(reflected_poly);
+    uint64_t rem = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        const bool carry = (rem >> 63) != 0;
+        rem <<= 1;
+        if (carry) {
+            rem ^= poly;
+        }
+    }
+    return Reflect64(rem);
+}
+
+inline constexpr uint32_t CRC32CPoly = 0x82F63B78;
+inline constexpr uint64_t CRC64Poly = 0xC96C5795D7870F42;
+
+#if CRUNCH_X86_INTRINSICS
+/**
+ * @brief CRC32C update using the SSE4.2 `crc32` instruction.
+ */
+__attribute__((target("sse4.2"))) inline uint32_t CRC32CUpdateSSE42(
+    uint32_t crc, std::span<const std::byte> data) noexcept {
+    const std::byte* p = data.data();
+    std::size_t n = data.size();
+    uint64_t crc64 = crc;
+    for (; n >= 8; n -= 8, p += 8) {
+        uint64_t block;
+        std::memcpy(&block, p, sizeof(block));
+        crc64 = _mm_crc32_u64(crc64, block);
+    }
+    auto crc32 = static_cast<uint32_t>(crc64);
+    for (; n > 0; --n, ++p) {
+        crc32 = _mm_crc32_u8(crc32, static_cast<uint8_t>(*p));
+    }
+    return crc32;
+}
+
+/**
+ * @brief Folds a 128-bit CRC accumulator forward with carry-less multiplies.
+ *
+ * The low lane of `k` holds x^(d+63) mod P and the high lane x^(d-1) mod P
+ * (bit-reflected), where d is the folding distance in bits.
+ */
+__attribute__((target("pclmul,sse4.1"))) inline __m128i CRCFold(
+    __m128i acc, __m128i k) noexcept {
+    return _mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x00),
+                         _mm_clmulepi64_si128(acc, k, 0x11));
+}
+
+/**
+ * @brief CRC64 update using PCLMULQDQ folding.
+ *
+ * Folds four 128-bit lanes per 64-byte block, merges them, then reduces the
+ * final 128-bit accumulator with the table engine.
+ */
+__attribute__((target("pclmul,sse4.1"))) inline uint64_t CRC64UpdatePCLMUL(
+    uint64_t crc, std::span<const std::byte> data) noexcept {
+    if (data.size() < 64) {
+        return ReflectedCRCUpdate<uint64_t, CRC64Poly>(crc, data);
+    }
+    constexpr uint64_t K511 = ReflectedXPowMod64(511, CRC64Poly);
+    constexpr uint64_t K575 = ReflectedXPowMod64(575, CRC64Poly);
+    constexpr uint64_t K127 = ReflectedXPowMod64(127, CRC64Poly);
+    constexpr uint64_t K191 = ReflectedXPowMod64(191, CRC64Poly);
+    const __m128i fold_by_4 = _mm_set_epi64x(static_cast<int64_t>(K511),
+                                             static_cast<int64_t>(K575));
+    const __m128i fold_by_1 = _mm_set_epi64x(static_cast<int64_t>(K127),
+                                             static_cast<int64_t>(K191));
+
+    const std::byte* p = data.data();
+    std::size_t n = data.size();
+    const auto* in = reinterpret_cast<const __m128i*>(p);
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(in),
+                               _mm_cvtsi64_si128(static_cast<int64_t>(crc)));
+    __m128i x1 = _mm_loadu_si128(in + 1);
+    __m128i x2 = _mm_loadu_si128(in + 2);
+    __m128i x3 = _mm_loadu_si128(in + 3);
+    p += 64;
+    n -= 64;
+
+    for (; n >= 64; n -= 64, p += 64) {
+        in = reinterpret_cast<const __m128i*>(p);
+        x0 = _mm_xor_si128(CRCFold(x0, fold_by_4), _mm_loadu_si128(in));
+        x1 = _mm_xor_si128(CRCFold(x1, fold_by_4), _mm_loadu_si128(in + 1));
+        x2 = _mm_xor_si128(CRCFold(x2, fold_by_4), _mm_loadu_si128(in + 2));
+        x3 = _mm_xor_si128(CRCFold(x3, fold_by_4), _mm_loadu_si128(in + 3));
+    }
+
+    __m128i acc = _mm_xor_si128(CRCFold(x0, fold_by_1), x1);
+    acc = _mm_xor_si128(CRCFold(acc, fold_by_1), x2);
+    acc = _mm_xor_si128(CRCFold(acc, fold_by_1), x3);
+    for (; n >= 16; n -= 16, p += 16) {
+        acc = _mm_xor_si128(
+            CRCFold(acc, fold_by_1),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+
+    // The accumulator is congruent to the data consumed so far; running it
+    // through the table engine from a zero register yields the CRC register.
+    std::array<std::byte, 16> folded;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(folded.data()), acc);
+    crc = ReflectedCRCUpdate<uint64_t, CRC64Poly>(0, folded);
+    return ReflectedCRCUpdate<uint64_t, CRC64Poly>(crc, {p, n});
+}
+#endif
+
+}  // namespace detail
+/// @endcond
+
+/**
+ * @brief CRC-32C (Castagnoli) integrity policy.
+ *
+ * Adds 4 bytes of overhead. Uses reflected polynomial 0x82F63B78 with initial
+ * value and final XOR 0xFFFFFFFF.
+ *
+ * At runtime the SSE4.2 `crc32` instruction is used when the CPU supports
+ * it. Constant evaluation and other CPUs use a slice-by-8 table engine.
+ */
+struct CRC32C {
+    using State = uint32_t;
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return 4; }
+
+    /**
+     * @brief Calculates the CRC-32C checksum.
+     * @param data The byte span to calculate checksum over.
+     * @return 4-byte array containing the checksum (big-endian).
+     */
+    [[nodiscard]] static constexpr auto calculate(
+        std::span<const std::byte> data) noexcept -> std::array<std::byte, 4> {
+        return finalize(update(init(), data));
+    }
+
+    /**
+     * @brief Returns the initial CRC-32C register value.
+     */
+    [[nodiscard]] static constexpr State init() noexcept { return 0xFFFFFFFF; }
+
+    /**
+     * @brief Applies the final XOR and converts a register value into
+     * checksum bytes.
+     * @param crc The register value.
+     * @return 4-byte array containing the checksum (big-endian).
+     */
+    [[nodiscard]] static constexpr auto finalize(State crc) noexcept
+        -> std::array<std::byte, 4> {
+        return detail::ToBigEndianBytes(crc ^ 0xFFFFFFFF);
+    }
+
+    /**
+     * @brief Folds more bytes into a running CRC-32C register.
+     * @param crc The current register value.
+     * @param data The bytes to fold in.
+     * @return The updated register value.
+     */
+    [[nodiscard]] static constexpr State update(
+        State crc, std::span<const std::byte> data) noexcept {
+#if CRUNCH_X86_INTRINSICS
+        if (!std::is_constant_evaluated() &&
+            __builtin_cpu_supports("sse4.2")) {
+            return detail::CRC32CUpdateSSE42(crc, data);
+        }
+#endif
+        return detail::ReflectedCRCUpdate<uint32_t, detail::CRC32CPoly>(crc,
+                                                                        data);
+    }
+    /**
+     * @brief Updates a checksum after some bytes of the data changed.
+     * @param checksum The checksum before the change.
+     * @param old_bytes The bytes before the change.
+     * @param new_bytes The bytes after the change, same length.
+     * @param trailing The number of data bytes after the changed bytes.
+     * @return The checksum after the change.
+     */
+    [[nodiscard]] static constexpr auto patch(
+        const std::array<std::byte, 4>& checksum,
+        std::span<const std::byte> old_bytes,
+        std::span<const std::byte> new_bytes, std::size_t trailing) noexcept
+        -> std::array<std::byte, 4> {
+        using Algebra = detail::CRCAlgebra<uint32_t, detail::CRC32CPoly, true>;
+        return detail::PatchCRC<CRC32C, Algebra>(checksum, old_bytes,
+                                                  new_bytes, trailing);
+    }
+};
+
+/**
+ * @brief CRC-64/XZ (ECMA-182) integrity policy.
+ *
+ * Adds 8 bytes of overhead. Uses reflected polynomial 0xC96C5795D7870F42 with
+ * initial value and final XOR 0xFFFFFFFFFFFFFFFF.
+ *
+ * At runtime PCLMULQDQ folding is used when the CPU supports it. Constant
+ * evaluation and other CPUs use a slice-by-8 table engine.
+ */
+struct CRC64 {
+    using State = uint64_t;
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return 8; }
+
+    /**
+     * @brief Calculates the CRC-64/XZ checksum.
+     * @param data The byte span to calculate checksum over.
+     * @return 8-byte array containing the checksum (big-endian).
+     */
+    [[nodiscard]] static constexpr auto calculate(
+        std::span<const std::byte> data) noexcept -> std::array<std::byte, 8> {
+        return finalize(update(init(), data));
+    }
+
+    /**
+     * @brief Returns the initial CRC-64/XZ register value.
+     */
+    [[nodiscard]] static constexpr State init() noexcept {
+        return ~uint64_t{0};
+    }
+
+    /**
+     * @brief Applies the final XOR and converts a register value into
+     * checksum bytes.
+     * @param crc The register value.
+     * @return 8-byte array containing the checksum (big-endian).
+     */
+    [[nodiscard]] static constexpr auto finalize(State crc) noexcept
+        -> std::array<std::byte, 8> {
+        return detail::ToBigEndianBytes(crc ^ ~uint64_t{0});
+    }
+
+    /**
+     * @brief Folds more bytes into a running CRC-64/XZ register.
+     * @param crc The current register value.
+     * @param data The bytes to fold in.
+     * @return The updated register value.
+     */
+    [[nodiscard]] static constexpr State update(
+        State crc, std::span<const std::byte> data) noexcept {
+#if CRUNCH_X86_INTRINSICS
+        if (!std::is_constant_evaluated() &&
+            __builtin_cpu_supports("pclmul") &&
+            __builtin_cpu_supports("sse4.1")) {
+            return detail::CRC64UpdatePCLMUL(crc, data);
+        }
+#endif
+        return detail::ReflectedCRCUpdate<uint64_t, detail::CRC64Poly>(crc,
+                                                                       data);
+    }
+    /**
+     * @brief Updates a checksum after some bytes of the data changed.
+     * @param checksum The checksum before the change.
+     * @param old_bytes The bytes before the change.
+     * @param new_bytes The bytes after the change, same length.
+     * @param trailing The number of data bytes after the changed bytes.
+     * @return The checksum after the change.
+     */
+    [[nodiscard]] static constexpr auto patch(
+        const std::array<std::byte, 8>& checksum,
+        std::span<const std::byte> old_bytes,
+        std::span<const std::byte> new_bytes, std::size_t trailing) noexcept
+        -> std::array<std::byte, 8> {
+        using Algebra = detail::CRCAlgebra<uint64_t, detail::CRC64Poly, true>;
+        return detail::PatchCRC<CRC64, Algebra>(checksum, old_bytes,
+                                                  new_bytes, trailing);
+    }
+};
+
+/**
+ * @brief XXH3 64-bit hash integrity policy.
+ *
+ * Adds 8 bytes of overhead. Computes XXH3_64bits (seed 0) as defined by
+ * xxHash 0.8, which detects corruption as well as a CRC on random errors and
+ * is faster on large messages.
+ *
+ * Inputs above 240 bytes use AVX2 or SSE2 at runtime. Constant evaluation
+ * uses a portable scalar loop with identical output.
+ */
+struct XXH3_64 {
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return 8; }
+
+    /**
+     * @brief Calculates the XXH3 64-bit hash.
+     * @param data The byte span to hash.
+     * @return 8-byte array containing the hash (big-endian).
+     */
+    [[nodiscard]] static constexpr auto calculate(
+        std::span<const std::byte> data) noexcept -> std::array<std::byte, 8> {
+        return detail::ToBigEndianBytes(detail::XXH3::hash(data));
+    }
+};
+
+/**
+ * @brief 32-bit truncation of the XXH3 64-bit hash.
+ *
+ * Adds 4 bytes of overhead. Stores the low 32 bits of XXH3_64bits (seed 0).
+ */
+struct XXH3_32 {
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return 4; }
+
+    /**
+     * @brief Calculates the truncated XXH3 hash.
+     * @param data The byte span to hash.
+     * @return 4-byte array containing the hash (big-endian).
+     */
+    [[nodiscard]] static constexpr auto calculate(
+        std::span<const std::byte> data) noexcept -> std::array<std::byte, 4> {
+        return detail::ToBigEndianBytes(
+            static_cast<uint32_t>(detail::XXH3::hash(data)));
     }
 };
 
@@ -0,0 +1,494 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#ifndef CRUNCH_X86_INTRINSICS
+#error "Include <crunch/integrity/crunch_integrity.hpp> instead."
+#endif
+
+/// @cond INTERNAL
+namespace Crunch::integrity::detail {
+
+/**
+ * @brief XXH3 64-bit hash (seed 0, default secret).
+ *
+ * A port of the XXH3_64bits() algorithm from xxHash 0.8. Output matches the
+ * reference implementation bit for bit.
+ *
+ * Inputs up to 240 bytes use the short-input mixers. Longer inputs use the
+ * striped accumulator loop. During constant evaluation the loop runs in
+ * portable scalar code. At runtime on x86-64 it runs with SSE2, or with AVX2
+ * when the CPU supports it.
+ */
+struct XXH3 {
+    /**
+     * @brief Hashes a byte span.
+     * @param data The bytes to hash.
+     * @return The 64-bit hash.
+     */
+    [[nodiscard]] static constexpr uint64_t hash(
+        std::span<const std::byte> data) noexcept {
+        const std::size_t len = data.size();
+        if (len <= 16) {
+            return hash_0to16(data);
+        }
+        if (len <= 128) {
+            return hash_17to128(data);
+        }
+        if (len <= MidSizeMax) {
+            return hash_129to240(data);
+        }
+        return hash_long(data);
+    }
+
+   private:
+    static constexpr uint64_t Prime32_1 = 0x9E3779B1U;
+    static constexpr uint64_t Prime32_2 = 0x85EBCA77U;
+    static constexpr uint64_t Prime32_3 = 0xC2B2AE3DU;
+    static constexpr uint64_t Prime64_1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t Prime64_3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr uint64_t Prime64_5 = 0x27D4EB2F165667C5ULL;
+    static constexpr uint64_t PrimeMx1 = 0x165667919E3779F9ULL;
+    static constexpr uint64_t PrimeMx2 = 0x9FB21C651E98DF25ULL;
+
+    static constexpr std::size_t MidSizeMax = 240;
+    static constexpr std::size_t StripeLen = 64;
+    static constexpr std::size_t SecretConsumeRate = 8;
+    static constexpr std::size_t SecretSizeMin = 136;
+    static constexpr std::size_t SecretLastAccStart = 7;
+    static constexpr std::size_t SecretMergeAccsStart = 11;
+    static constexpr std::size_t MidSizeStartOffset = 3;
+    static constexpr std::size_t MidSizeLastOffset = 17;
+
+    // cppcheck-suppress unusedStructMember
+    static constexpr std::array<uint8_t, 192> Secret = {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c,
+        0xf7, 0x21, 0xad, 0x1c, 0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb,
+        0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f, 0xcb, 0x79, 0xe6, 0x4e,
+        0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6,
+        0x81, 0x3a, 0x26, 0x4c, 0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb,
+        0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3, 0x71, 0x64, 0x48, 0x97,
+        0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7,
+        0xc7, 0x0b, 0x4f, 0x1d, 0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+        0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64, 0xea, 0xc5, 0xac, 0x83,
+        0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26,
+        0x29, 0xd4, 0x68, 0x9e, 0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc,
+        0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce, 0x45, 0xcb, 0x3a, 0x8f,
+        0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+    };
+
+    using Accumulators = std::array<uint64_t, StripeLen / sizeof(uint64_t)>;
+
+    static constexpr Accumulators InitAcc = {
+        Prime32_3, Prime64_1, Prime64_2, Prime64_3,
+        Prime64_4, Prime32_2, Prime64_5, Prime32_1};
+
+    [[nodiscard]] static constexpr uint64_t read64(
+        std::span<const std::byte> data, std::size_t offset) noexcept {
+        uint64_t value = 0;
+        for (std::size_t i = 0; i < 8; ++i) {
+            value |= static_cast<uint64_t>(data[offset + i]) << (8 * i);
+        }
+        return value;
+    }
+
+    [[nodiscard]] static constexpr uint32_t read32(
+        std::span<const std::byte> data, std::size_t offset) noexcept {
+        uint32_t value = 0;
+        for (std::size_t i = 0; i < 4; ++i) {
+            value |= static_cast<uint32_t>(data[offset + i]) << (8 * i);
+        }
+        return value;
+    }
+
+    [[nodiscard]] static constexpr uint64_t secret64(
+        std::size_t offset) noexcept {
+        uint64_t value = 0;
+        for (std::size_t i = 0; i < 8; ++i) {
+            value |= static_cast<uint64_t>(Secret[offset + i]) << (8 * i);
+        }
+        return value;
+    }
+
+    [[nodiscard]] static constexpr uint64_t secret32(
+        std::size_t offset) noexcept {
+        return secret64(offset) & 0xFFFFFFFF;
+    }
+
+    /**
+     * @brief 64x64 -> 128 bit multiply, folded by XOR of the two halves.
+     */
+    [[nodiscard]] static constexpr uint64_t mul128_fold64(
+        uint64_t lhs, uint64_t rhs) noexcept {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using UInt128 = unsigned __int128;
+        const UInt128 product = static_cast<UInt128>(lhs) * rhs;
+        return static_cast<uint64_t>(product) ^
+               static_cast<uint64_t>(product >> 64);
+#else
+        const uint64_t lo_lo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+        const uint64_t hi_lo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+        const uint64_t lo_hi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+        const uint64_t hi_hi = (lhs >> 32) * (rhs >> 32);
+        const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+        const uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+        const uint64_t lower = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+        return lower ^ upper;
+#endif
+    }
+
+    [[nodiscard]] static constexpr uint64_t rotl64(uint64_t v,
+                                                   int r) noexcept {
+        return (v << r) | (v >> (64 - r));
+    }
+
+    [[nodiscard]] static constexpr uint64_t swap64(uint64_t v) noexcept {
+        uint64_t out = 0;
+        for (int i = 0; i < 8; ++i) {
+            out = (out << 8) | ((v >> (8 * i)) & 0xFF);
+        }
+        return out;
+    }
+
+    [[nodiscard]] static constexpr uint64_t xxh64_avalanche(
+        uint64_t h) noexcept {
+        h ^= h >> 33;
+        h *= Prime64_2;
+        h ^= h >> 29;
+        h *= Prime64_3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    [[nodiscard]] static constexpr uint64_t avalanche(uint64_t h) noexcept {
+        h ^= h >> 37;
+        h *= PrimeMx1;
+        h ^= h >> 32;
+        return h;
+    }
+
+    [[nodiscard]] static constexpr uint64_t rrmxmx(uint64_t h,
+                                                   uint64_t len) noexcept {
+        h ^= rotl64(h, 49) ^ rotl64(h, 24);
+        h *= PrimeMx2;
+        h ^= (h >> 35) + len;
+        h *= PrimeMx2;
+        return h ^ (h >> 28);
+    }
+
+    [[nodiscard]] static constexpr uint64_t hash_0to16(
+        std::span<const std::byte> data) noexcept {
+        const std::size_t len = data.size();
+        if (len > 8) {
+            const uint64_t bitflip1 = secret64(24) ^ secret64(32);
+            const uint64_t bitflip2 = secret64(40) ^ secret64(48);
+            const uint64_t input_lo = read64(data, 0) ^ bitflip1;
+            const uint64_t input_hi = read64(data, len - 8) ^ bitflip2;
+            const uint64_t acc = len + swap64(input_lo) + input_hi +
+                                 mul128_fold64(input_lo, input_hi);
+            return avalanche(acc);
+        }
+        if (len >= 4) {
+            const uint64_t input1 = read32(data, 0);
+            const uint64_t input2 = read32(data, len - 4);
+            const uint64_t bitflip = secret64(8) ^ secret64(16);
+            const uint64_t input64 = input2 + (input1 << 32);
+            return rrmxmx(input64 ^ bitflip, len);
+        }
+        if (len > 0) {
+            const auto c1 = static_cast<uint32_t>(data[0]);
+            const auto c2 = static_cast<uint32_t>(data[len >> 1]);
+            const auto c3 = static_cast<uint32_t>(data[len - 1]);
+            const uint32_t combined = (c1 << 16) | (c2 << 24) | c3 |
+                                      (static_cast<uint32_t>(len) << 8);
+            const uint64_t bitflip = secret32(0) ^ secret32(4);
+            return xxh64_avalanche(combined ^ bitflip);
+        }
+        return xxh64_avalanche(secret64(56) ^ secret64(64));
+    }
+
+    [[nodiscard]] static constexpr uint64_t mix16(
+        std::span<const std::byte> data, std::size_t offset,
+        std::size_t secret_offset) noexcept {
+        return mul128_fold64(read64(data, offset) ^ secret64(secret_offset),
+                             read64(data, offset + 8) ^
+                                 secret64(secret_offset + 8));
+    }
+
+    [[nodiscard]] static constexpr uint64_t hash_17to128(
+        std::span<const std::byte> data) noexcept {
+        const std::size_t len = data.size();
+        uint64_t acc = len * Prime64_1;
+        if (len > 32) {
+            if (len > 64) {
+                if (len > 96) {
+                    acc += mix16(data, 48, 96);
+                    acc += mix16(data, len - 64, 112);
+                }
+                acc += mix16(data, 32, 64);
+                acc += mix16(data, len - 48, 80);
+            }
+            acc += mix16(data, 16, 32);
+            acc += mix16(data, len - 32, 48);
+        }
+        acc += mix16(data, 0, 0);
+        acc += mix16(data, len - 16, 16);
+        return avalanche(acc);
+    }
+
+    [[nodiscard]] static constexpr uint64_t hash_129to240(
+        std::span<const std::byte> data) noexcept {
+        const std::size_t len = data.size();
+        uint64_t acc = len * Prime64_1;
+        for (std::size_t i = 0; i < 8; ++i) {
+            acc += mix16(data, 16 * i, 16 * i);
+        }
+        acc = avalanche(acc);
+        uint64_t acc_end =
+            mix16(data, len - 16, SecretSizeMin - MidSizeLastOffset);
+        const std::size_t rounds = len / 16;
+        for (std::size_t i = 8; i < rounds; ++i) {
+            acc_end += mix16(data, 16 * i, 16 * (i - 8) + MidSizeStartOffset);
+        }
+        return avalanche(acc + acc_end);
+    }
+
+    static constexpr void accumulate_512(
+        Accumulators& acc, std::span<const std::byte> data,
+        std::size_t offset, std::size_t secret_offset) noexcept {
+        for (std::size_t lane = 0; lane < acc.size(); ++lane) {
+            const uint64_t data_val = read64(data, offset + lane * 8);
+            const uint64_t data_key =
+                data_val ^ secret64(secret_offset + lane * 8);
+            acc[lane ^ 1] += data_val;
+            acc[lane] += (data_key & 0xFFFFFFFF) * (data_key >> 32);
+        }
+    }
+
+    static constexpr void scramble(Accumulators& acc) noexcept {
+        for (std::size_t lane = 0; lane < acc.size(); ++lane) {
+            uint64_t a = acc[lane];
+            a ^= a >> 47;
+            a ^= secret64(Secret.size() - StripeLen + lane * 8);
+            acc[lane] = a * Prime32_1;
+        }
+    }
+
+    static constexpr std::size_t StripesPerBlock =
+        (Secret.size() - StripeLen) / SecretConsumeRate;
+    static constexpr std::size_t BlockLen = StripeLen * StripesPerBlock;
+
+    /**
+     * @brief Portable striped accumulator loop for inputs above 240 bytes.
+     */
+    [[nodiscard]] static constexpr Accumulators accumulate_scalar(
+        std::span<const std::byte> data) noexcept {
+        Accumulators acc = InitAcc;
+        const std::size_t len = data.size();
+        const std::size_t blocks = (len - 1) / BlockLen;
+        for (std::size_t n = 0; n < blocks; ++n) {
+            for (std::size_t s = 0; s < StripesPerBlock; ++s) {
+                accumulate_512(acc, data, n * BlockLen + s * StripeLen,
+                               s * SecretConsumeRate);
+            }
+            scramble(acc);
+        }
+        const std::size_t stripes = ((len - 1) - BlockLen * blocks) / StripeLen;
+        for (std::size_t s = 0; s < stripes; ++s) {
+            accumulate_512(acc, data, blocks * BlockLen + s * StripeLen,
+                           s * SecretConsumeRate);
+        }
+        accumulate_512(acc, data, len - StripeLen,
+                       Secret.size() - StripeLen - SecretLastAccStart);
+        return acc;
+    }
+
+#if CRUNCH_X86_INTRINSICS
+    /**
+     * @brief SSE2 striped accumulator loop (baseline on x86-64).
+     */
+    [[nodiscard]] static Accumulators accumulate_sse2(
+        std::span<const std::byte> data) noexcept {
+        const auto* secret = reinterpret_cast<const __m128i*>(Secret.data());
+        const auto load = [](const std::byte* p) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        };
+        constexpr std::size_t Lanes = StripeLen / sizeof(__m128i);
+        __m128i acc[Lanes];
+        for (std::size_t i = 0; i < Lanes; ++i) {
+            acc[i] = load(reinterpret_cast<const std::byte*>(InitAcc.data()) +
+                          16 * i);
+        }
+
+        const auto stripe = [&](const std::byte* in,
+                                const std::byte* key) noexcept {
+            for (std::size_t i = 0; i < Lanes; ++i) {
+                const __m128i data_vec = load(in + 16 * i);
+                const __m128i key_vec = load(key + 16 * i);
+                const __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+                const __m128i data_key_lo =
+                    _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+                const __m128i product = _mm_mul_epu32(data_key, data_key_lo);
+                const __m128i data_swap =
+                    _mm_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+                acc[i] = _mm_add_epi64(product,
+                                       _mm_add_epi64(acc[i], data_swap));
+            }
+        };
+        const auto scramble_acc = [&]() noexcept {
+            const __m128i prime32 =
+                _mm_set1_epi32(static_cast<int>(Prime32_1));
+            const __m128i* key = secret + (Secret.size() - StripeLen) / 16;
+            for (std::size_t i = 0; i < Lanes; ++i) {
+                const __m128i shifted = _mm_srli_epi64(acc[i], 47);
+                const __m128i data_key = _mm_xor_si128(
+                    _mm_xor_si128(acc[i], shifted), _mm_loadu_si128(key + i));
+                const __m128i data_key_hi =
+                    _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+                const __m128i prod_lo = _mm_mul_epu32(data_key, prime32);
+                const __m128i prod_hi = _mm_mul_epu32(data_key_hi, prime32);
+                acc[i] = _mm_add_epi64(prod_lo, _mm_slli_epi64(prod_hi, 32));
+            }
+        };
+
+        const auto* key_bytes = reinterpret_cast<const std::byte*>(secret);
+        const std::byte* in = data.data();
+        const std::size_t len = data.size();
+        const std::size_t blocks = (len - 1) / BlockLen;
+        for (std::size_t n = 0; n < blocks; ++n) {
+            for (std::size_t s = 0; s < StripesPerBlock; ++s) {
+                stripe(in + n * BlockLen + s * StripeLen,
+                       key_bytes + s * SecretConsumeRate);
+            }
+            scramble_acc();
+        }
+        const std::size_t stripes = ((len - 1) - BlockLen * blocks) / StripeLen;
+        for (std::size_t s = 0; s < stripes; ++s) {
+            stripe(in + blocks * BlockLen + s * StripeLen,
+                   key_bytes + s * SecretConsumeRate);
+        }
+        stripe(in + len - StripeLen,
+               key_bytes + Secret.size() - StripeLen - SecretLastAccStart);
+
+        Accumulators out;
+        for (std::size_t i = 0; i < Lanes; ++i) {
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(out.data() + 2 * i), acc[i]);
+        }
+        return out;
+    }
+
+    /**
+     * @brief AVX2 accumulate of one 64-byte stripe into two 256-bit lanes.
+     */
+    __attribute__((target("avx2"))) static void stripe_avx2(
+        __m256i& acc0, __m256i& acc1, const std::byte* in,
+        const std::byte* key) noexcept {
+        const __m256i data0 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+        const __m256i data1 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 32));
+        const __m256i key0 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key));
+        const __m256i key1 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + 32));
+        const __m256i dk0 = _mm256_xor_si256(data0, key0);
+        const __m256i dk1 = _mm256_xor_si256(data1, key1);
+        const __m256i prod0 = _mm256_mul_epu32(dk0, _mm256_srli_epi64(dk0, 32));
+        const __m256i prod1 = _mm256_mul_epu32(dk1, _mm256_srli_epi64(dk1, 32));
+        acc0 = _mm256_add_epi64(
+            prod0, _mm256_add_epi64(acc0, _mm256_shuffle_epi32(
+                                              data0, _MM_SHUFFLE(1, 0, 3, 2))));
+        acc1 = _mm256_add_epi64(
+            prod1, _mm256_add_epi64(acc1, _mm256_shuffle_epi32(
+                                              data1, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+
+    /**
+     * @brief AVX2 scramble of one 256-bit accumulator lane.
+     */
+    __attribute__((target("avx2"))) static __m256i scramble_avx2(
+        __m256i acc, const std::byte* key) noexcept {
+        const __m256i prime32 = _mm256_set1_epi32(static_cast<int>(Prime32_1));
+        const __m256i data_key = _mm256_xor_si256(
+            _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47)),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key)));
+        const __m256i prod_lo = _mm256_mul_epu32(data_key, prime32);
+        const __m256i prod_hi =
+            _mm256_mul_epu32(_mm256_srli_epi64(data_key, 32), prime32);
+        return _mm256_add_epi64(prod_lo, _mm256_slli_epi64(prod_hi, 32));
+    }
+
+    /**
+     * @brief AVX2 striped accumulator loop.
+     */
+    __attribute__((target("avx2"))) static Accumulators accumulate_avx2(
+        std::span<const std::byte> data) noexcept {
+        const auto* key = reinterpret_cast<const std::byte*>(Secret.data());
+        __m256i acc0 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&InitAcc[0]));
+        __m256i acc1 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&InitAcc[4]));
+
+        const std::byte* in = data.data();
+        const std::size_t len = data.size();
+        const std::size_t blocks = (len - 1) / BlockLen;
+        const std::byte* scramble_key = key + Secret.size() - StripeLen;
+        for (std::size_t n = 0; n < blocks; ++n) {
+            for (std::size_t s = 0; s < StripesPerBlock; ++s) {
+                stripe_avx2(acc0, acc1, in + n * BlockLen + s * StripeLen,
+                            key + s * SecretConsumeRate);
+            }
+            acc0 = scramble_avx2(acc0, scramble_key);
+            acc1 = scramble_avx2(acc1, scramble_key + 32);
+        }
+        const std::size_t stripes = ((len - 1) - BlockLen * blocks) / StripeLen;
+        for (std::size_t s = 0; s < stripes; ++s) {
+            stripe_avx2(acc0, acc1, in + blocks * BlockLen + s * StripeLen,
+                        key + s * SecretConsumeRate);
+        }
+        stripe_avx2(acc0, acc1, in + len - StripeLen,
+                    key + Secret.size() - StripeLen - SecretLastAccStart);
+
+        Accumulators out;
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[0]), acc0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[4]), acc1);
+        return out;
+    }
+#endif
+
+    [[nodiscard]] static constexpr uint64_t hash_long(
+        std::span<const std::byte> data) noexcept {
+        Accumulators acc{};
+#if CRUNCH_X86_INTRINSICS
+        if (std::is_constant_evaluated()) {
+            acc = accumulate_scalar(data);
+        } else if (__builtin_cpu_supports("avx2")) {
+            acc = accumulate_avx2(data);
+        } else {
+            acc = accumulate_sse2(data);
+        }
+#else
+        acc = accumulate_scalar(data);
+#endif
+        uint64_t result = data.size() * Prime64_1;
+        for (std::size_t i = 0; i < 4; ++i) {
+            const std::size_t offset = SecretMergeAccsStart + 16 * i;
+            result += mul128_fold64(acc[2 * i] ^ secret64(offset),
+                                    acc[2 * i + 1] ^ secret64(offset + 8));
+        }
+        return avalanche(result);
+    }
+};
+
+}  // namespace Crunch::integrity::detail
+/// @endcond
@@ -13,9 +13,12 @@
 #include <utility>
 
 namespace Crunch::serdes {
-template <std::size_t Alignment>
+enum class UnusedCapacity : uint8_t;
+template <std::size_t Alignment, UnusedCapacity Unused>
 struct StaticLayout;
-struct TlvLayout;
+enum class SignedEncoding : uint8_t;
+template <SignedEncoding Signed>
+struct BasicTlvLayout;
 }  // namespace Crunch::serdes
 
 namespace Crunch::messages {
@@ -189,9 +192,10 @@ class Field {
      *       serializers access to the internal state without adding each new
      *       serializer to the Field class. Maybe via a proxy class.
      */
-    template <std::size_t Alignment>
+    template <std::size_t Alignment, Crunch::serdes::UnusedCapacity Unused>
     friend struct Crunch::serdes::StaticLayout;
-    friend struct Crunch::serdes::TlvLayout;
+    template <Crunch::serdes::SignedEncoding Signed>
+    friend struct Crunch::serdes::BasicTlvLayout;
 };
 
 template <typename T>
@@ -432,9 +436,10 @@ class ArrayField {
     std::array<ElementType, MaxSize> items_{};
     std::size_t current_len_{0};
 
-    template <std::size_t Alignment>
+    template <std::size_t Alignment, Crunch::serdes::UnusedCapacity Unused>
     friend struct Crunch::serdes::StaticLayout;
-    friend struct Crunch::serdes::TlvLayout;
+    template <Crunch::serdes::SignedEncoding Signed>
+    friend struct Crunch::serdes::BasicTlvLayout;
 };
 
 // Helper to extract ValueType for Scalar/String, or use T itself for others
@@ -705,9 +710,10 @@ class MapField {
         }
     }
 
-    template <std::size_t Alignment>
+    template <std::size_t Alignment, Crunch::serdes::UnusedCapacity Unused>
     friend struct Crunch::serdes::StaticLayout;
-    friend struct Crunch::serdes::TlvLayout;
+    template <Crunch::serdes::SignedEncoding Signed>
+    friend struct Crunch::serdes::BasicTlvLayout;
 };
 
 }  // namespace Crunch::messages
@@ -105,6 +105,48 @@ concept HasConstexprGetFields = requires {
 };
 /// @endcond
 
+/**
+ * @brief The position of the field with a given FieldId in a message's
+ * get_fields() tuple.
+ *
+ * Equal to the number of fields if the message has no field with that id.
+ *
+ * @tparam Message The message type.
+ * @tparam Id The FieldId to look up.
+ */
+template <typename Message, FieldId Id>
+inline constexpr std::size_t field_index_v = [] {
+    using Fields =
+        std::remove_cvref_t<decltype(std::declval<Message&>().get_fields())>;
+    return []<std::size_t... Is>(std::index_sequence<Is...>) {
+        std::size_t index = sizeof...(Is);
+        ((std::remove_cvref_t<std::tuple_element_t<Is, Fields>>::field_id == Id
+              ? (index = Is)
+              : 0),
+         ...);
+        return index;
+    }(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+}();
+
+/**
+ * @brief Whether a message has a field with a given FieldId.
+ */
+template <typename Message, FieldId Id>
+inline constexpr bool has_field_v =
+    field_index_v<Message, Id> <
+    std::tuple_size_v<
+        std::remove_cvref_t<decltype(std::declval<Message&>().get_fields())>>;
+
+/**
+ * @brief The type of the field with a given FieldId in a message.
+ */
+template <typename Message, FieldId Id>
+    requires has_field_v<Message, Id>
+using field_t = std::remove_cvref_t<
+    std::tuple_element_t<field_index_v<Message, Id>,
+                         std::remove_cvref_t<decltype(std::declval<Message&>()
+                                                          .get_fields())>>>;
+
 /**
  * @brief Concept ensuring a type is a fully valid CrunchMessage.
  *
@@ -52,4 +52,141 @@ concept SerdesPolicy =
         { Policy::GetFormat() } -> std::same_as<Format>;
     };
 
+/**
+ * @brief Concept for a SerdesPolicy that can report the exact serialized size
+ * of a message before writing it.
+ *
+ * In addition to SerdesPolicy, the policy provides:
+ * - `SerializedSize(msg)`: The number of bytes `Serialize(msg, output)`
+ * returns, including the header. At most `Size<Message>()`.
+ */
+template <typename Policy, typename Message>
+concept SizedSerdesPolicy =
+    SerdesPolicy<Policy, Message> && requires(const Message& msg) {
+        { Policy::SerializedSize(msg) } -> std::same_as<std::size_t>;
+    };
+
+/**
+ * @brief Concept for a SerdesPolicy whose frame length can be read from the
+ * first few bytes of a frame, so frames can be cut out of a byte stream.
+ *
+ * In addition to SerdesPolicy, the policy provides:
+ * - `FramePrefixSize`: The number of leading bytes FrameLength reads.
+ * - `FrameLength<Message>(prefix)`: The length of the frame starting with
+ * `prefix`, excluding the checksum. Not bounded by `Size<Message>()`.
+ */
+template <typename Policy, typename Message>
+concept FramedSerdesPolicy =
+    SerdesPolicy<Policy, Message> &&
+    requires(std::span<const std::byte> prefix) {
+        { Policy::FramePrefixSize } -> std::convertible_to<std::size_t>;
+        {
+            Policy::template FrameLength<Message>(prefix)
+        } -> std::same_as<std::size_t>;
+    };
+
+/**
+ * @brief Concept for a SerdesPolicy whose Deserialize rewrites every field of
+ * the message, including presence flags and array and map lengths.
+ *
+ * A message decoded over one left from an earlier frame then keeps nothing
+ * from it, so a decoder can reuse the message without resetting it first.
+ * The policy opts in with `static constexpr bool OverwritesAllFields = true`.
+ */
+template <typename Policy, typename Message>
+concept OverwritingSerdesPolicy =
+    SerdesPolicy<Policy, Message> &&
+    requires { requires Policy::OverwritesAllFields; };
+
+/**
+ * @brief Concept for a SerdesPolicy that reports bytes as it touches them.
+ *
+ * In addition to SerdesPolicy, the policy provides:
+ * - `Serialize(msg, output, fold)`: Calls `fold` with consecutive,
+ * non-overlapping chunks of the output that together cover every byte written
+ * (starting at offset 0, so the header is included). A chunk is only reported
+ * once its bytes are final.
+ * - `Deserialize(input, msg, fold)`: Calls `fold` with consecutive chunks of
+ * the input, starting at offset 0, as they are consumed.
+ *
+ * These pair with an IncrementalIntegrityPolicy to checksum the message while
+ * it is still in cache instead of making a second pass over the buffer.
+ */
+template <typename Policy, typename Message>
+concept FoldingSerdesPolicy =
+    SerdesPolicy<Policy, Message> &&
+    requires(const Message& msg, Message& out, std::span<std::byte> output,
+             std::span<const std::byte> input,
+             void (*fold)(std::span<const std::byte>)) {
+        { Policy::Serialize(msg, output, fold) } -> std::same_as<std::size_t>;
+        {
+            Policy::Deserialize(input, out, fold)
+        } -> std::same_as<std::optional<Error>>;
+    };
+
+/**
+ * @brief Concept for a SerdesPolicy whose fields can be read in place.
+ *
+ * Every value sits at an offset that only depends on the types involved and
+ * where the enclosing value starts, so a View can find a field without
+ * decoding the ones before it. In addition to SerdesPolicy, the policy
+ * provides:
+ * - `PayloadOffset()`: The offset of the first top-level field.
+ * - `FieldOffset<Message, Index>(offset)`: The offset of a message's
+ * Index-th field, given the offset of its first field.
+ * - `ValueOffset<T>(offset)`: The offset of a value's first byte past any
+ * padding.
+ * - `ValueEndOffset<T>(offset)`: The offset just past a value.
+ * - `ElementOffset<Ts...>(offset, index)`: The offset of the index-th
+ * element of an array (`Ts` is the element type) or map (`Ts` is the key and
+ * value type), given the offset of the first element.
+ */
+template <typename Policy, typename Message>
+concept InPlaceSerdesPolicy =
+    SerdesPolicy<Policy, Message> &&
+    requires(std::size_t offset, std::size_t index) {
+        { Policy::PayloadOffset() } -> std::same_as<std::size_t>;
+        {
+            Policy::template FieldOffset<Message, 0>(offset)
+        } -> std::same_as<std::size_t>;
+        {
+            Policy::template ValueOffset<Message>(offset)
+        } -> std::same_as<std::size_t>;
+        {
+            Policy::template ValueEndOffset<Message>(offset)
+        } -> std::same_as<std::size_t>;
+        {
+            Policy::template ElementOffset<Message>(offset, index)
+        } -> std::same_as<std::size_t>;
+        {
+            Policy::template ElementOffset<Message, Message>(offset, index)
+        } -> std::same_as<std::size_t>;
+    };
+
+/**
+ * @brief Concept for an InPlaceSerdesPolicy that can overwrite one scalar
+ * field of a serialized message without touching the other bytes.
+ *
+ * In addition to InPlaceSerdesPolicy, the policy provides:
+ * - `OffsetOf<Message, Id>()`: The offset of the field in the serialized
+ * message. Must be a constant expression.
+ * - `WriteField<Message, Id>(output, value)`: Validates the value and writes
+ * it, marking the field as set. Only bytes in
+ * `[OffsetOf, ValueEndOffset<FieldType>(OffsetOf + 1))` may change.
+ */
+template <typename Policy, typename Message, FieldId Id>
+concept FieldWriterSerdesPolicy =
+    InPlaceSerdesPolicy<Policy, Message> &&
+    requires(std::span<std::byte> output,
+             typename messages::field_t<Message, Id>::FieldType::ValueType
+                 value) {
+        {
+            std::bool_constant<(Policy::template OffsetOf<Message, Id>(),
+                                true)>()
+        } -> std::same_as<std::true_type>;
+        {
+            Policy::template WriteField<Message, Id>(output, value)
+        } -> std::same_as<std::optional<Error>>;
+    };
+
 }  // namespace Crunch
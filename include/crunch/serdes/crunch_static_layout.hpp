@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <concepts>
 #include <crunch/core/crunch_endian.hpp>
 #include <crunch/core/crunch_types.hpp>
@@ -14,17 +15,40 @@
 #include <optional>
 #include <span>
 #include <tuple>
+#include <utility>
 
 namespace Crunch::serdes {
 
+/**
+ * @brief How StaticLayout writes bytes that Deserialize never reads.
+ *
+ * These are the unused slots of arrays and maps, string capacity past the
+ * current length, and the value region of unset fields.
+ */
+enum class UnusedCapacity : uint8_t {
+    Zero,  ///< Zero-fill them. Output depends only on the message.
+    Skip,  ///< Leave them untouched. Output is deterministic only if the
+           ///< buffer was zeroed beforehand (e.g. a fresh GetBuffer()).
+};
+
 /**
  * @brief A deterministic, fixed-size binary serialization policy.
+ *
+ * Both UnusedCapacity modes produce the same format and read each other's
+ * output. Skip avoids writing mostly-empty capacity, but a reused buffer
+ * then carries stale bytes from earlier messages in those regions.
  */
-template <std::size_t Alignment = 1>
+template <std::size_t Alignment = 1,
+          UnusedCapacity Unused = UnusedCapacity::Zero>
 struct StaticLayout {
     static_assert(Alignment == 1 || Alignment == 4 || Alignment == 8,
                   "StaticLayout only supports 1, 4, or 8 byte alignment.");
 
+    /// The value type of the scalar field with FieldId Id in a message.
+    template <typename Message, FieldId Id>
+    using ScalarValueOf =
+        typename messages::field_t<Message, Id>::FieldType::ValueType;
+
     /**
      * @brief Gets the Crunch format corresponding to the alignment.
      * @return The format enum.
@@ -49,6 +73,36 @@ struct StaticLayout {
         return PayloadStartOffset + calculate_payload_size(Message{});
     }
 
+    /**
+     * @brief The exact serialized size of a message, which for a static
+     * layout is always Size<Message>().
+     * @tparam Message The message type.
+     * @return The size in bytes.
+     */
+    template <typename Message>
+    [[nodiscard]] static constexpr std::size_t SerializedSize(
+        const Message&) noexcept {
+        return Size<Message>();
+    }
+
+    /// Every frame's length is known from its header alone.
+    static constexpr std::size_t FramePrefixSize = StandardHeaderSize;
+
+    /// Deserialize writes every field's presence flag and length.
+    static constexpr bool OverwritesAllFields = true;
+
+    /**
+     * @brief The length of a frame, excluding the checksum, which for a
+     * static layout is always Size<Message>().
+     * @tparam Message The message type named by the frame's header.
+     * @return The size in bytes.
+     */
+    template <typename Message>
+    [[nodiscard]] static constexpr std::size_t FrameLength(
+        std::span<const std::byte>) noexcept {
+        return Size<Message>();
+    }
+
     /**
      * @brief Serializes a message into the output buffer.
      * @tparam Message The message type.
@@ -59,6 +113,26 @@ struct StaticLayout {
     template <typename Message>
     static constexpr std::size_t Serialize(
         const Message& msg, std::span<std::byte> output) noexcept {
+        return Serialize(msg, output, [](std::span<const std::byte>) {});
+    }
+
+    /**
+     * @brief Serializes a message, reporting each finished region of output.
+     *
+     * `fold` receives the header first, then each top-level field right after
+     * it is written.
+     *
+     * @tparam Message The message type.
+     * @tparam Fold Callable accepting `std::span<const std::byte>`.
+     * @param msg The message to serialize.
+     * @param output The output buffer.
+     * @param fold Called with each finished chunk, in order.
+     * @return The number of bytes written.
+     */
+    template <typename Message, typename Fold>
+    static constexpr std::size_t Serialize(const Message& msg,
+                                           std::span<std::byte> output,
+                                           Fold&& fold) noexcept {
         // Header (including MessageId) is written by top-level serializer
         // Zero-fill any alignment padding between header and payload start
         if (PayloadStartOffset > StandardHeaderSize) {
@@ -66,11 +140,24 @@ struct StaticLayout {
                         PayloadStartOffset - StandardHeaderSize);
         }
         std::size_t offset = PayloadStartOffset;
+        fold(std::span<const std::byte>{output.data(), offset});
+
+        if constexpr (is_flat_message<Message>()) {
+            const std::size_t start = offset;
+            offset = serialize_flat_fields<0>(msg, output, offset);
+            fold(std::span<const std::byte>{output.data() + start,
+                                            offset - start});
+            return offset;
+        }
 
+        const auto serialize_and_fold = [&](const auto& field) {
+            const std::size_t start = offset;
+            offset = serialize_field(field, output, offset);
+            fold(std::span<const std::byte>{output.data() + start,
+                                            offset - start});
+        };
         std::apply(
-            [&](const auto&... fields) {
-                ((offset = serialize_field(fields, output, offset)), ...);
-            },
+            [&](const auto&... fields) { (serialize_and_fold(fields), ...); },
             msg.get_fields());
         return offset;
     }
@@ -86,8 +173,40 @@ struct StaticLayout {
     [[nodiscard]] static constexpr auto Deserialize(
         std::span<const std::byte> input, Message& msg) noexcept
         -> std::optional<Error> {
+        return Deserialize(input, msg, [](std::span<const std::byte>) {});
+    }
+
+    /**
+     * @brief Deserializes a message, reporting each consumed region of input.
+     *
+     * `fold` receives the header first, then each top-level field right after
+     * it is decoded. On error, the chunks reported so far are exactly the
+     * bytes that were consumed.
+     *
+     * @tparam Message The message type.
+     * @tparam Fold Callable accepting `std::span<const std::byte>`.
+     * @param input The input buffer.
+     * @param msg The message object to populate.
+     * @param fold Called with each consumed chunk, in order.
+     * @return std::nullopt on success, or an Error on failure.
+     */
+    template <typename Message, typename Fold>
+    [[nodiscard]] static constexpr auto Deserialize(
+        std::span<const std::byte> input, Message& msg, Fold&& fold) noexcept
+        -> std::optional<Error> {
+        if (input.size() < Size<Message>()) {
+            return Error::deserialization("buffer too small for message");
+        }
         // Header (including MessageId) validated by top-level deserializer
         std::size_t offset = PayloadStartOffset;
+        fold(input.first(offset));
+
+        if constexpr (is_flat_message<Message>()) {
+            const std::size_t end =
+                deserialize_flat_fields<0>(msg, input, offset);
+            fold(input.subspan(offset, end - offset));
+            return std::nullopt;
+        }
 
         std::optional<Error> err = std::nullopt;
         std::apply(
@@ -98,6 +217,8 @@ struct StaticLayout {
                             auto result =
                                 deserialize_field(fields, input, offset);
                             if (result.has_value()) {
+                                fold(input.subspan(offset,
+                                                   result.value() - offset));
                                 offset = result.value();
                             } else {
                                 err = result.error();
@@ -109,6 +230,180 @@ struct StaticLayout {
         return err;
     }
 
+    /**
+     * @brief Gets the offset of the first top-level field.
+     * @return The offset in bytes from the start of the buffer.
+     */
+    [[nodiscard]] static constexpr std::size_t PayloadOffset() noexcept {
+        return PayloadStartOffset;
+    }
+
+    /**
+     * @brief Gets the offset of a field in constant time.
+     *
+     * This is the presence byte, or for arrays and maps the start of the
+     * length prefix's padding.
+     *
+     * @tparam Message The message type.
+     * @tparam Index The field's position in get_fields().
+     * @param fields_offset The offset of the message's first field.
+     * @return The offset of the field.
+     */
+    template <typename Message, std::size_t Index>
+    [[nodiscard]] static constexpr std::size_t FieldOffset(
+        std::size_t fields_offset) noexcept {
+        return fields_offset +
+               FieldStarts<Message>[fields_offset % Alignment][Index];
+    }
+
+    /**
+     * @brief Gets the offset of a value's first byte past its padding.
+     *
+     * That byte starts the length prefix of strings, arrays and maps, and the
+     * MessageId of nested messages.
+     *
+     * @tparam T The value type.
+     * @param offset The offset the value starts at.
+     * @return The offset of the value's first byte.
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr std::size_t ValueOffset(
+        std::size_t offset) noexcept {
+        if constexpr (fields::is_string_v<T> || messages::is_array_field_v<T> ||
+                      messages::is_map_field_v<T>) {
+            return offset + calculate_padding<uint32_t>(offset);
+        } else if constexpr (messages::CrunchMessage<T>) {
+            return offset + calculate_padding<std::byte[Alignment]>(offset);
+        } else {
+            return offset + calculate_padding<typename T::ValueType>(offset);
+        }
+    }
+
+    /**
+     * @brief Gets the offset just past a value in constant time.
+     * @tparam T The value type.
+     * @param offset The offset the value starts at.
+     * @return The offset after the value.
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr std::size_t ValueEndOffset(
+        std::size_t offset) noexcept {
+        return value_end_offset<T>(offset);
+    }
+
+    /**
+     * @brief Gets the offset of an array or map element in constant time.
+     *
+     * @tparam Ts The values making up one element: the element type for
+     * arrays, the key and value types for maps.
+     * @param first The offset of the first element, past the length prefix.
+     * @param index The element's index.
+     * @return The offset the element starts at.
+     */
+    template <typename... Ts>
+    [[nodiscard]] static constexpr std::size_t ElementOffset(
+        std::size_t first, std::size_t index) noexcept {
+        const auto& cycle = ElementCycles<Ts...>[first % Alignment];
+        if (index < cycle.cycle_start + cycle.period) {
+            return first + cycle.starts[index];
+        }
+        const std::size_t into_cycle = index - cycle.cycle_start;
+        return first +
+               cycle.starts[cycle.cycle_start + into_cycle % cycle.period] +
+               into_cycle / cycle.period * cycle.period_bytes;
+    }
+
+    /**
+     * @brief Gets the offset of a top-level field in a serialized message.
+     *
+     * This is the field's presence byte, or for arrays and maps the start of
+     * the length prefix's padding, counted from the start of the header.
+     *
+     * @tparam Message The message type.
+     * @tparam Id The field's FieldId.
+     * @return The offset in bytes.
+     */
+    template <typename Message, FieldId Id>
+        requires messages::has_field_v<Message, Id>
+    [[nodiscard]] static consteval std::size_t OffsetOf() noexcept {
+        return FieldOffset<Message, messages::field_index_v<Message, Id>>(
+            PayloadStartOffset);
+    }
+
+    /**
+     * @brief Reads one top-level scalar field of a serialized message without
+     * decoding the others.
+     *
+     * Validators are not run.
+     *
+     * @tparam Message The message type.
+     * @tparam Id The field's FieldId.
+     * @param input The serialized message, starting at the header.
+     * @return The value, std::nullopt if the field is unset, or an Error if
+     * the buffer is too small.
+     */
+    template <typename Message, FieldId Id>
+        requires messages::has_field_v<Message, Id> &&
+                 fields::is_scalar_v<
+                     typename messages::field_t<Message, Id>::FieldType>
+    [[nodiscard]] static constexpr auto ReadField(
+        std::span<const std::byte> input) noexcept
+        -> std::expected<std::optional<ScalarValueOf<Message, Id>>, Error> {
+        using ValT = ScalarValueOf<Message, Id>;
+        constexpr std::size_t Offset = OffsetOf<Message, Id>();
+        constexpr std::size_t At =
+            Offset + 1 + calculate_padding<ValT>(Offset + 1);
+        if (input.size() < At + sizeof(ValT)) {
+            return std::unexpected(
+                Error::deserialization("buffer too small for message"));
+        }
+        if (!static_cast<bool>(input[Offset])) {
+            return std::nullopt;
+        }
+        ValT le_value;
+        std::memcpy(&le_value, input.data() + At, sizeof(le_value));
+        return Crunch::LittleEndian(le_value);
+    }
+
+    /**
+     * @brief Sets one top-level scalar field of a serialized message in
+     * place without touching the others.
+     *
+     * The value is checked against the field's validators first. Only the
+     * presence byte and the value bytes are written, so any checksum over
+     * the message must be recomputed afterwards.
+     *
+     * @tparam Message The message type.
+     * @tparam Id The field's FieldId.
+     * @param output The serialized message, starting at the header.
+     * @param value The new value.
+     * @return std::nullopt on success, or an Error if the value is invalid or
+     * the buffer is too small.
+     */
+    template <typename Message, FieldId Id>
+        requires messages::has_field_v<Message, Id> &&
+                 fields::is_scalar_v<
+                     typename messages::field_t<Message, Id>::FieldType>
+    [[nodiscard]] static constexpr auto WriteField(
+        std::span<std::byte> output,
+        ScalarValueOf<Message, Id> value) noexcept -> std::optional<Error> {
+        using ValT = ScalarValueOf<Message, Id>;
+        constexpr std::size_t Offset = OffsetOf<Message, Id>();
+        constexpr std::size_t At =
+            Offset + 1 + calculate_padding<ValT>(Offset + 1);
+        if (output.size() < At + sizeof(ValT)) {
+            return Error::capacity_exceeded(Id, "buffer too small for message");
+        }
+        using Scalar = typename messages::field_t<Message, Id>::FieldType;
+        if (auto err = Scalar::Validate(value, Id); err) {
+            return err;
+        }
+        output[Offset] = std::byte{1};
+        const auto le_value = Crunch::LittleEndian(value);
+        std::memcpy(output.data() + At, &le_value, sizeof(le_value));
+        return std::nullopt;
+    }
+
    private:
     /**
      * @brief Aligns a value up to the specified alignment.
@@ -138,6 +433,10 @@ struct StaticLayout {
     static constexpr std::size_t PayloadStartOffset =
         align_up(StandardHeaderSize, Alignment);
 
+    /// Offset of a nested message's first field modulo Alignment. Nested
+    /// messages start aligned, so this is constant.
+    static constexpr std::size_t NestedPhase = sizeof(MessageId) % Alignment;
+
     /**
      * @brief Calculates the size of the message payload.
      * @tparam Message The message type.
@@ -147,7 +446,19 @@ struct StaticLayout {
     template <typename Message>
     [[nodiscard]] static constexpr std::size_t calculate_payload_size(
         const Message& msg) noexcept {
-        std::size_t offset = 0;
+        return calculate_fields_end_offset(msg, 0);
+    }
+
+    /**
+     * @brief Calculates the end offset of a message's fields.
+     * @tparam Message The message type.
+     * @param msg The message instance.
+     * @param offset The offset of the first field.
+     * @return The offset after the last field.
+     */
+    template <typename Message>
+    [[nodiscard]] static constexpr std::size_t calculate_fields_end_offset(
+        const Message& msg, std::size_t offset) noexcept {
         std::apply(
             [&](const auto&... fields) {
                 ((offset = calculate_field_end_offset(fields, offset)), ...);
@@ -156,6 +467,20 @@ struct StaticLayout {
         return offset;
     }
 
+    /**
+     * @brief Calculates the payload size of a nested message.
+     *
+     * Field padding depends on where the payload starts, so this is measured
+     * from NestedPhase rather than from 0.
+     *
+     * @tparam T The message type.
+     * @return The payload size in bytes.
+     */
+    template <typename T>
+    [[nodiscard]] static consteval std::size_t nested_payload_size() noexcept {
+        return calculate_fields_end_offset(T{}, NestedPhase) - NestedPhase;
+    }
+
     /**
      * @brief Calculates the end offset of a value based on its type.
      * @tparam T The value type.
@@ -208,7 +533,7 @@ struct StaticLayout {
         const std::size_t padding =
             calculate_padding<std::byte[Alignment]>(offset);
         offset += padding;
-        offset += sizeof(MessageId) + calculate_payload_size(T{});
+        offset += sizeof(MessageId) + nested_payload_size<T>();
         return offset;
     }
 
@@ -285,6 +610,249 @@ struct StaticLayout {
         return offset;
     }
 
+    /// Bytes taken by a value of type T, indexed by its start offset modulo
+    /// Alignment. Padding only depends on that phase.
+    template <typename T>
+    static constexpr auto ValueSpans = [] {
+        std::array<std::size_t, Alignment> spans{};
+        for (std::size_t phase = 0; phase < Alignment; ++phase) {
+            spans[phase] = calculate_value_end_offset<T>(phase) - phase;
+        }
+        return spans;
+    }();
+
+    /**
+     * @brief Looks up the end offset of a value in constant time.
+     * @tparam T The value type.
+     * @param offset The start offset.
+     * @return The end offset, equal to calculate_value_end_offset<T>(offset).
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr std::size_t value_end_offset(
+        std::size_t offset) noexcept {
+        return offset + ValueSpans<T>[offset % Alignment];
+    }
+
+    /// The field tuple type of a message.
+    template <typename Message>
+    using FieldsOf =
+        std::remove_cvref_t<decltype(std::declval<Message&>().get_fields())>;
+
+    /// Offsets of each field of a message relative to its first field,
+    /// indexed by the first field's offset modulo Alignment.
+    template <typename Message>
+    static constexpr auto FieldStarts = [] {
+        constexpr std::size_t Count = std::tuple_size_v<FieldsOf<Message>>;
+        std::array<std::array<std::size_t, Count>, Alignment> starts{};
+        for (std::size_t phase = 0; phase < Alignment; ++phase) {
+            std::size_t offset = phase;
+            std::size_t index = 0;
+            std::apply(
+                [&](const auto&... fields) {
+                    ((starts[phase][index++] = offset - phase,
+                      offset = calculate_field_end_offset(fields, offset)),
+                     ...);
+                },
+                Message{}.get_fields());
+        }
+        return starts;
+    }();
+
+    /**
+     * @brief Where consecutive elements start, relative to the first.
+     *
+     * An element's padding only depends on its start offset modulo
+     * Alignment, so the sequence of phases repeats within Alignment + 1
+     * elements. After that, offsets advance by period_bytes every period
+     * elements.
+     */
+    struct ElementCycle {
+        std::array<std::size_t, Alignment + 1> starts{};  ///< Up to the repeat.
+        std::size_t cycle_start = 0;   ///< First element of the cycle.
+        std::size_t period = 1;        ///< Elements per cycle.
+        std::size_t period_bytes = 0;  ///< Bytes per cycle.
+    };
+
+    /// Element cycles for elements made of values Ts..., indexed by the
+    /// first element's offset modulo Alignment.
+    template <typename... Ts>
+    static constexpr auto ElementCycles = [] {
+        std::array<ElementCycle, Alignment> cycles{};
+        for (std::size_t phase = 0; phase < Alignment; ++phase) {
+            ElementCycle& cycle = cycles[phase];
+            std::size_t offset = phase;
+            for (std::size_t i = 0; i <= Alignment; ++i) {
+                cycle.starts[i] = offset - phase;
+                for (std::size_t j = 0; j < i; ++j) {
+                    if ((cycle.starts[j] + phase) % Alignment ==
+                        offset % Alignment) {
+                        cycle.cycle_start = j;
+                        cycle.period = i - j;
+                        cycle.period_bytes = cycle.starts[i] - cycle.starts[j];
+                        i = Alignment;
+                        break;
+                    }
+                }
+                ((offset = value_end_offset<Ts>(offset)), ...);
+            }
+        }
+        return cycles;
+    }();
+
+    /**
+     * @brief Whether a field is a presence byte followed by a scalar value.
+     * @tparam Field The field type.
+     */
+    template <typename Field>
+    [[nodiscard]] static consteval bool is_scalar_field() noexcept {
+        if constexpr (messages::is_array_field_v<Field> ||
+                      messages::is_map_field_v<Field>) {
+            return false;
+        } else {
+            return fields::is_scalar_v<typename Field::FieldType>;
+        }
+    }
+
+    /**
+     * @brief Whether every field of a message is a scalar field.
+     *
+     * The payload of such a message has a fixed shape known at compile time,
+     * so it can be written with one fill and constant-offset stores instead
+     * of walking the fields and computing padding at each step.
+     *
+     * @tparam Message The message type.
+     */
+    template <typename Message>
+    [[nodiscard]] static consteval bool is_flat_message() noexcept {
+        using Fields = FieldsOf<Message>;
+        return []<std::size_t... Is>(std::index_sequence<Is...>) {
+            return (is_scalar_field<std::remove_cvref_t<
+                        std::tuple_element_t<Is, Fields>>>() &&
+                    ...);
+        }(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+    }
+
+    /**
+     * @brief Payload offsets of a flat message, relative to its first field.
+     * @tparam N The number of fields.
+     */
+    template <std::size_t N>
+    struct FlatPlan {
+        std::array<std::size_t, N> presence{};  ///< Presence byte offsets.
+        std::array<std::size_t, N> value{};     ///< Scalar value offsets.
+        std::size_t size = 0;                   ///< Payload size in bytes.
+    };
+
+    /**
+     * @brief Computes the field offsets of a flat message.
+     * @tparam Message The message type.
+     * @tparam Phase The first field's offset modulo Alignment.
+     * @return The offsets of each presence byte and value.
+     */
+    template <typename Message, std::size_t Phase>
+    [[nodiscard]] static consteval auto plan_flat_message() noexcept {
+        using Fields = FieldsOf<Message>;
+        FlatPlan<std::tuple_size_v<Fields>> plan;
+        std::size_t offset = Phase;
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (
+                [&] {
+                    using ScalarT = typename std::remove_cvref_t<
+                        std::tuple_element_t<Is, Fields>>::FieldType;
+                    plan.presence[Is] = offset - Phase;
+                    offset = calculate_scalar_end_offset<ScalarT>(offset + 1);
+                    plan.value[Is] =
+                        offset - Phase - sizeof(typename ScalarT::ValueType);
+                }(),
+                ...);
+        }(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+        plan.size = offset - Phase;
+        return plan;
+    }
+
+    /**
+     * @brief Serializes the fields of a flat message.
+     *
+     * Zeroes the whole payload once, then stores each set field's presence
+     * byte and little-endian value at its precomputed offset. Under
+     * UnusedCapacity::Skip only the presence bytes and set values are
+     * written.
+     *
+     * @tparam Phase The offset modulo Alignment, as passed to the planner.
+     * @tparam Message The message type.
+     * @param msg The message to serialize.
+     * @param output The output buffer.
+     * @param offset The current offset.
+     * @return The updated offset.
+     */
+    template <std::size_t Phase, typename Message>
+    [[nodiscard]] static constexpr std::size_t serialize_flat_fields(
+        const Message& msg, std::span<std::byte> output,
+        std::size_t offset) noexcept {
+        constexpr auto Plan = plan_flat_message<Message, Phase>();
+        std::byte* const base = output.data() + offset;
+        if constexpr (Unused == UnusedCapacity::Zero) {
+            std::memset(base, 0, Plan.size);
+        }
+
+        const auto fields = msg.get_fields();
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (
+                [&] {
+                    const auto& field = std::get<Is>(fields);
+                    base[Plan.presence[Is]] =
+                        static_cast<std::byte>(field.set_ ? 1 : 0);
+                    if (field.set_) {
+                        const auto le_value =
+                            Crunch::LittleEndian(field.value_.get());
+                        std::memcpy(base + Plan.value[Is], &le_value,
+                                    sizeof(le_value));
+                    }
+                }(),
+                ...);
+        }(std::make_index_sequence<Plan.presence.size()>{});
+        return offset + Plan.size;
+    }
+
+    /**
+     * @brief Deserializes the fields of a flat message.
+     *
+     * The caller must have checked that the payload is in bounds.
+     *
+     * @tparam Phase The offset modulo Alignment, as passed to the planner.
+     * @tparam Message The message type.
+     * @param msg The message to populate.
+     * @param input The input buffer.
+     * @param offset The current offset.
+     * @return The updated offset.
+     */
+    template <std::size_t Phase, typename Message>
+    [[nodiscard]] static constexpr std::size_t deserialize_flat_fields(
+        Message& msg, std::span<const std::byte> input,
+        std::size_t offset) noexcept {
+        constexpr auto Plan = plan_flat_message<Message, Phase>();
+        const std::byte* const base = input.data() + offset;
+
+        const auto fields = msg.get_fields();
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (
+                [&] {
+                    auto& field = std::get<Is>(fields);
+                    field.set_ = static_cast<bool>(base[Plan.presence[Is]]);
+                    if (field.set_) {
+                        typename std::remove_cvref_t<
+                            decltype(field.value_)>::ValueType le_value;
+                        std::memcpy(&le_value, base + Plan.value[Is],
+                                    sizeof(le_value));
+                        field.value_.set_without_validation(
+                            Crunch::LittleEndian(le_value));
+                    }
+                }(),
+                ...);
+        }(std::make_index_sequence<Plan.presence.size()>{});
+        return offset + Plan.size;
+    }
+
     /**
      * @brief Serializes a value.
      * @tparam T The value type.
@@ -338,9 +906,10 @@ struct StaticLayout {
             } else {
                 // Zero fill unset fields
                 const std::size_t end_offset =
-                    calculate_value_end_offset<ValueType>(offset);
-                const std::size_t size = end_offset - offset;
-                std::memset(output.data() + offset, 0, size);
+                    value_end_offset<ValueType>(offset);
+                if constexpr (Unused == UnusedCapacity::Zero) {
+                    std::memset(output.data() + offset, 0, end_offset - offset);
+                }
                 return end_offset;
             }
         }
@@ -369,7 +938,11 @@ struct StaticLayout {
         std::memcpy(output.data() + offset, &le_len, sizeof(len));
         offset += sizeof(len);
 
-        std::memcpy(output.data() + offset, value.buffer_.data(), T::max_size);
+        // The buffer past current_len_ is always zero, so one copy of the
+        // full capacity is the zero fill.
+        const std::size_t copy_len =
+            Unused == UnusedCapacity::Zero ? T::max_size : value.current_len_;
+        std::memcpy(output.data() + offset, value.buffer_.data(), copy_len);
         offset += T::max_size;
         return offset;
     }
@@ -398,6 +971,9 @@ struct StaticLayout {
         std::memcpy(output.data() + offset, &le_msgId, sizeof(msgId));
         offset += sizeof(msgId);
 
+        if constexpr (is_flat_message<T>()) {
+            return serialize_flat_fields<NestedPhase>(value, output, offset);
+        }
         std::apply(
             [&](const auto&... fields) {
                 ((offset = serialize_field(fields, output, offset)), ...);
@@ -443,7 +1019,7 @@ struct StaticLayout {
     [[nodiscard]] static constexpr std::size_t serialize_array(
         const T& value, std::span<std::byte> output,
         std::size_t offset) noexcept {
-        using ValT = typename T::ValueType;
+        const std::size_t array_end = value_end_offset<T>(offset);
         const std::size_t padding = calculate_padding<uint32_t>(offset);
         if (padding > 0) {
             std::memset(output.data() + offset, 0, padding);
@@ -461,12 +1037,10 @@ struct StaticLayout {
         }
 
         // Zero fill remaining slots
-        for (std::size_t i = value.current_len_; i < T::max_size; ++i) {
-            const std::size_t end = calculate_value_end_offset<ValT>(offset);
-            std::memset(output.data() + offset, 0, end - offset);
-            offset = end;
+        if constexpr (Unused == UnusedCapacity::Zero) {
+            std::memset(output.data() + offset, 0, array_end - offset);
         }
-        return offset;
+        return array_end;
     }
 
     /**
@@ -481,9 +1055,7 @@ struct StaticLayout {
     [[nodiscard]] static constexpr std::size_t serialize_map(
         const T& value, std::span<std::byte> output,
         std::size_t offset) noexcept {
-        using KeyField = typename T::PairType::first_type;
-        using ValueField = typename T::PairType::second_type;
-
+        const std::size_t map_end = value_end_offset<T>(offset);
         const std::size_t padding = calculate_padding<uint32_t>(offset);
         if (padding > 0) {
             std::memset(output.data() + offset, 0, padding);
@@ -503,18 +1075,10 @@ struct StaticLayout {
         }
 
         // Zero fill remaining slots
-        for (std::size_t i = value.current_len_; i < T::max_size; ++i) {
-            const std::size_t key_end =
-                calculate_value_end_offset<KeyField>(offset);
-            std::memset(output.data() + offset, 0, key_end - offset);
-            offset = key_end;
-
-            const std::size_t val_end =
-                calculate_value_end_offset<ValueField>(offset);
-            std::memset(output.data() + offset, 0, val_end - offset);
-            offset = val_end;
+        if constexpr (Unused == UnusedCapacity::Zero) {
+            std::memset(output.data() + offset, 0, map_end - offset);
         }
-        return offset;
+        return map_end;
     }
 
     /**
@@ -593,6 +1157,12 @@ struct StaticLayout {
         }
         offset += sizeof(MessageId);
 
+        if constexpr (is_flat_message<T>()) {
+            if (set) {
+                return deserialize_flat_fields<NestedPhase>(value, input,
+                                                            offset);
+            }
+        }
         if (set) {
             std::optional<Error> err = std::nullopt;
             std::apply(
@@ -616,7 +1186,7 @@ struct StaticLayout {
             }
         } else {
             // Skip over submessage
-            offset += calculate_payload_size(T{});
+            offset += nested_payload_size<T>();
         }
         return offset;
     }
@@ -674,8 +1244,9 @@ struct StaticLayout {
                     0,
                     "deserialized string too long"));  // No ID available here
             }
-            std::memcpy(value.buffer_.data(), input.data() + offset,
-                        T::max_size);
+            // Bytes past len may be stale under UnusedCapacity::Skip.
+            std::memcpy(value.buffer_.data(), input.data() + offset, len);
+            std::fill(value.buffer_.begin() + len, value.buffer_.end(), '\0');
             value.current_len_ = len;
         } else {
             value.clear();
@@ -697,7 +1268,7 @@ struct StaticLayout {
     [[nodiscard]] static constexpr auto deserialize_array(
         T& value, bool set, std::span<const std::byte> input,
         std::size_t offset) noexcept -> std::expected<std::size_t, Error> {
-        const auto array_end = calculate_array_end_offset<T>(offset);
+        const auto array_end = value_end_offset<T>(offset);
 
         if (!set) {
             value.clear();
@@ -742,7 +1313,7 @@ struct StaticLayout {
     [[nodiscard]] static constexpr auto deserialize_map(
         T& value, bool set, std::span<const std::byte> input,
         std::size_t offset) noexcept -> std::expected<std::size_t, Error> {
-        const auto map_end = calculate_map_end_offset<T>(offset);
+        const auto map_end = value_end_offset<T>(offset);
 
         if (!set) {
             value.clear();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <crunch/core/crunch_endian.hpp>
 #include <crunch/core/crunch_types.hpp>
@@ -26,7 +28,10 @@ namespace Crunch::serdes {
  *
  * Implements a Tag-Length-Value serialization format where:
  * - Fields are identified by Field ID and Wire Type.
- * - Integers/Floats/Bool are encoded as Varints.
+ * - Integers/Bool are encoded as Varints. Signed integers use the
+ * layout's SignedEncoding (two's complement for TlvLayout, ZigZag for
+ * TlvZigZagLayout).
+ * - Floats are encoded as Fixed32/Fixed64 little-endian bit patterns.
  * - Strings, Nested Messages, and Packed Arrays are LengthDelimited.
  * - The top-level message body is length-prefixed (4 bytes) to handle buffer
  * padding.
@@ -50,16 +55,42 @@ struct ext<T> {
 
 }  // namespace detail
 
-struct TlvLayout {
+/**
+ * @brief How signed integers are mapped to Varints.
+ */
+enum class SignedEncoding : uint8_t {
+    /// Two's complement bit pattern of the same width, so any negative value
+    /// takes the maximum Varint size for its type (e.g. 5 bytes for int32,
+    /// 2 for int8).
+    TwosComplement,
+    /// ZigZag (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...). Small magnitudes of
+    /// either sign take 1-2 bytes.
+    ZigZag,
+};
+
+template <SignedEncoding Signed>
+struct BasicTlvLayout {
     /**
      * @brief Wire types for TLV encoding.
      */
     enum class WireType : uint8_t {
         Varint = 0,
         LengthDelimited = 1,
+        Fixed32 = 2,  ///< 4 little-endian bytes (Float32).
+        Fixed64 = 3,  ///< 8 little-endian bytes (Float64).
     };
 
-    static constexpr Crunch::Format GetFormat() { return Crunch::Format::TLV; }
+    /**
+     * @brief Gets the Crunch format corresponding to the signed encoding.
+     * @return The format enum.
+     */
+    static constexpr Crunch::Format GetFormat() {
+        if constexpr (Signed == SignedEncoding::ZigZag) {
+            return Crunch::Format::TLVZigZag;
+        } else {
+            return Crunch::Format::TLV;
+        }
+    }
 
     /**
      * @brief Number of bits used for the wire type in a tag.
@@ -84,6 +115,43 @@ struct TlvLayout {
                calculate_max_message_size<Message>();
     }
 
+    /**
+     * @brief Calculates the exact serialized size of a message.
+     *
+     * Walks the set fields once without writing anything.
+     *
+     * @tparam Message The message type.
+     * @param msg The message to measure.
+     * @return The number of bytes Serialize writes, including the header.
+     */
+    template <typename Message>
+    [[nodiscard]] static constexpr std::size_t SerializedSize(
+        const Message& msg) noexcept {
+        LengthPrefixes measure_only{};
+        return Crunch::StandardHeaderSize + sizeof(uint32_t) +
+               message_content_size(msg, measure_only);
+    }
+
+    /// The header and the payload length which follows it.
+    static constexpr std::size_t FramePrefixSize =
+        Crunch::StandardHeaderSize + sizeof(uint32_t);
+
+    /**
+     * @brief Reads the length of a frame, excluding the checksum, from its
+     * payload length prefix.
+     * @tparam Message The message type named by the frame's header.
+     * @param prefix At least the first FramePrefixSize bytes of the frame.
+     * @return The size in bytes. Not checked against Size<Message>().
+     */
+    template <typename Message>
+    [[nodiscard]] static constexpr std::size_t FrameLength(
+        std::span<const std::byte> prefix) noexcept {
+        uint32_t le_len;
+        std::memcpy(&le_len, prefix.data() + Crunch::StandardHeaderSize,
+                    sizeof(uint32_t));
+        return FramePrefixSize + Crunch::LittleEndian(le_len);
+    }
+
     /**
      * @brief Serializes a message into the output buffer.
      * @tparam Message The message type.
@@ -94,14 +162,45 @@ struct TlvLayout {
     template <typename Message>
     [[nodiscard]] static constexpr std::size_t Serialize(
         const Message& msg, std::span<std::byte> output) noexcept {
+        return Serialize(msg, output, [](std::span<const std::byte>) {});
+    }
+
+    /**
+     * @brief Serializes a message, reporting each finished region of output.
+     *
+     * The body length prefix is only known once every field is written, so
+     * `fold` receives the header and length prefix, then the whole body.
+     *
+     * @tparam Message The message type.
+     * @tparam Fold Callable accepting `std::span<const std::byte>`.
+     * @param msg The message to serialize.
+     * @param output The output buffer.
+     * @param fold Called with each finished chunk, in order.
+     * @return The number of bytes written (offset).
+     */
+    template <typename Message, typename Fold>
+    [[nodiscard]] static constexpr std::size_t Serialize(
+        const Message& msg, std::span<std::byte> output, Fold&& fold) noexcept {
         // Header (including MessageId) is written by top-level serializer
         std::size_t offset = Crunch::StandardHeaderSize;
 
         const std::size_t length_field_offset = offset;
         offset += sizeof(uint32_t);
 
+        // Size every length-prefixed value up front so each prefix is
+        // written once, at its final width.
+        constexpr std::size_t MaxLengthPrefixes =
+            max_message_length_prefixes<Message>();
+        std::array<uint32_t, MaxLengthPrefixes> content_sizes;
+        LengthPrefixes lengths{content_sizes};
+        if constexpr (MaxLengthPrefixes > 0) {
+            static_cast<void>(message_content_size(msg, lengths));
+            lengths.next = 0;
+        }
+
         const std::size_t payload_start = offset;
-        offset = serialize_fields_helper(msg.get_fields(), output, offset);
+        offset =
+            serialize_fields_helper(msg.get_fields(), output, offset, lengths);
 
         const std::size_t payload_size = offset - payload_start;
         const uint32_t le_len =
@@ -109,6 +208,9 @@ struct TlvLayout {
         std::memcpy(output.data() + length_field_offset, &le_len,
                     sizeof(uint32_t));
 
+        fold(std::span<const std::byte>{output.data(), payload_start});
+        fold(std::span<const std::byte>{output.data() + payload_start,
+                                        payload_size});
         return offset;
     }
 
@@ -123,6 +225,27 @@ struct TlvLayout {
     [[nodiscard]] static constexpr auto Deserialize(
         std::span<const std::byte> input, Message& msg) noexcept
         -> std::optional<Error> {
+        return Deserialize(input, msg, [](std::span<const std::byte>) {});
+    }
+
+    /**
+     * @brief Deserializes a message, reporting each consumed region of input.
+     *
+     * `fold` receives the header and length prefix, then each top-level field
+     * (tag and value) right after it is decoded. On error, the chunks reported
+     * so far are exactly the bytes that were consumed.
+     *
+     * @tparam Message The message type.
+     * @tparam Fold Callable accepting `std::span<const std::byte>`.
+     * @param input The input buffer.
+     * @param msg The message object to populate.
+     * @param fold Called with each consumed chunk, in order.
+     * @return std::nullopt on success, or Error.
+     */
+    template <typename Message, typename Fold>
+    [[nodiscard]] static constexpr auto Deserialize(
+        std::span<const std::byte> input, Message& msg, Fold&& fold) noexcept
+        -> std::optional<Error> {
         // Header (including MessageId) validated by top-level deserializer
         std::size_t offset = Crunch::StandardHeaderSize;
 
@@ -139,8 +262,9 @@ struct TlvLayout {
             return Error::deserialization("tlv length exceeds buffer");
         }
 
+        fold(input.first(offset));
         return deserialize_message_payload(
-            input.subspan(0, offset + payload_len), msg, offset);
+            input.subspan(0, offset + payload_len), msg, offset, fold);
     }
 
    private:
@@ -191,142 +315,242 @@ struct TlvLayout {
     }
 
     /**
-     * @brief Calculates the maximum size of an array field.
+     * @brief Calculates the maximum size of a field's tag from its actual id.
      *
-     * All arrays use packed encoding:
-     * [Tag][TotalLength][Count][Elem1][Elem2]...
+     * The low bits are set to the largest wire type, so the bound holds for
+     * every wire type the field may be written with.
      *
-     * @tparam ElemT The element type of the array.
-     * @param max_elements The maximum number of elements in the array.
+     * @tparam Id The field ID.
      * @return The maximum size in bytes.
      */
-    template <typename ElemT>
-    [[nodiscard]] static consteval std::size_t calculate_max_array_field_size(
-        std::size_t max_elements) noexcept {
-        constexpr std::size_t tag_size = Varint::max_varint_size(MaxTagBits);
-        constexpr std::size_t length_size = Varint::max_size;
-        constexpr std::size_t count_size = Varint::max_size;
-        constexpr std::size_t elem_size = calculate_max_value_size<ElemT>();
+    template <FieldId Id>
+    [[nodiscard]] static consteval std::size_t max_tag_size() noexcept {
+        return Varint::size((static_cast<uint64_t>(Id) << WireTypeBits) |
+                            ((1U << WireTypeBits) - 1));
+    }
 
-        return tag_size + length_size + count_size + (max_elements * elem_size);
+    /**
+     * @brief Calculates the maximum size of a length-prefixed value.
+     * @param max_content_size The maximum size of the content.
+     * @return The maximum size of the length prefix plus the content.
+     */
+    [[nodiscard]] static consteval std::size_t max_length_delimited_size(
+        std::size_t max_content_size) noexcept {
+        return Varint::size(max_content_size) + max_content_size;
     }
 
     /**
-     * @brief Calculates the maximum size of a scalar field.
+     * @brief Calculates the maximum size of a scalar value (no tag) from the
+     * width of its value type.
+     *
+     * Floats are fixed-width. Booleans take one byte. Integers and enums are
+     * Varints of their unsigned bit pattern (ZigZag or two's complement), so
+     * at most ceil(bits / 7) bytes.
+     *
      * @tparam ScalarT The scalar type.
      * @return The maximum size in bytes.
      */
     template <typename ScalarT>
     [[nodiscard]] static consteval std::size_t
-    calculate_max_scalar_field_size() noexcept {
-        constexpr std::size_t tag_size = Varint::max_varint_size(MaxTagBits);
-        return tag_size + Varint::max_size;
+    calculate_max_scalar_value_size() noexcept {
+        using T = typename ScalarT::ValueType;
+        if constexpr (std::is_floating_point_v<T>) {
+            return sizeof(T);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return 1;
+        } else {
+            return Varint::max_varint_size(sizeof(T) * 8);
+        }
     }
 
     /**
-     * @brief Calculates the maximum size of a string field.
-     * @tparam StringT The string type.
+     * @brief Calculates the maximum size of packed array content.
+     *
+     * Packed encoding: [Count][Elem1][Elem2]...
+     *
+     * @tparam ElemT The element type of the array.
+     * @param max_elements The maximum number of elements in the array.
      * @return The maximum size in bytes.
      */
-    template <typename StringT>
-    [[nodiscard]] static consteval std::size_t
-    calculate_max_string_field_size() noexcept {
-        constexpr std::size_t tag_size = Varint::max_varint_size(MaxTagBits);
-        return tag_size + Varint::max_size + StringT::max_size;
+    template <typename ElemT>
+    [[nodiscard]] static consteval std::size_t calculate_max_array_content_size(
+        std::size_t max_elements) noexcept {
+        return Varint::size(max_elements) +
+               max_elements * calculate_max_value_size<ElemT>();
     }
 
     /**
-     * @brief Calculates the maximum size of a nested message field.
-     * @tparam MsgT The nested message type.
+     * @brief Calculates the maximum size of packed map content.
+     *
+     * Packed encoding: [Count][Key1][Val1][Key2][Val2]...
+     *
+     * @tparam KeyT The key type.
+     * @tparam ValueT The value type.
+     * @param max_elements The maximum number of elements in the map.
      * @return The maximum size in bytes.
      */
-    template <typename MsgT>
-    [[nodiscard]] static consteval std::size_t
-    calculate_max_nested_message_field_size() noexcept {
-        constexpr std::size_t tag_size = Varint::max_varint_size(MaxTagBits);
-        return tag_size + Varint::max_size + calculate_max_message_size<MsgT>();
+    template <typename KeyT, typename ValueT>
+    [[nodiscard]] static consteval std::size_t calculate_max_map_content_size(
+        std::size_t max_elements) noexcept {
+        return Varint::size(max_elements) +
+               max_elements * (calculate_max_value_size<KeyT>() +
+                               calculate_max_value_size<ValueT>());
     }
 
     /**
-     * @brief Calculates the maximum serialized size of a value field (no tag).
-     * @tparam T The field type (key or value).
+     * @brief Calculates the maximum serialized size of a value (no tag).
+     * @tparam T The value type (field value, element, key or value).
      * @return The maximum size in bytes for this value type.
      */
     template <typename T>
     [[nodiscard]] static consteval std::size_t
     calculate_max_value_size() noexcept {
         if constexpr (Crunch::fields::is_scalar_v<T>) {
-            // Just the varint value, no tag
-            return Varint::max_size;
+            return calculate_max_scalar_value_size<T>();
         } else if constexpr (Crunch::fields::is_string_v<T>) {
             // [Length][Data]
-            return Varint::max_size + T::max_size;
+            return max_length_delimited_size(T::max_size);
         } else if constexpr (Crunch::messages::HasCrunchMessageInterface<T>) {
             // [Length][NestedFields]
-            return Varint::max_size + calculate_max_message_size<T>();
+            return max_length_delimited_size(calculate_max_message_size<T>());
         } else if constexpr (Crunch::messages::is_array_field_v<T>) {
-            return calculate_max_array_field_size<typename T::ValueType>(
-                T::max_size);
+            // [Length][Count][Elements]
+            return max_length_delimited_size(
+                calculate_max_array_content_size<typename T::ValueType>(
+                    T::max_size));
         } else if constexpr (Crunch::messages::is_map_field_v<T>) {
+            // [Length][Count][Pairs]
             using KeyType = typename T::PairType::first_type;
             using ValueType = typename T::PairType::second_type;
-            return calculate_max_map_field_size<KeyType, ValueType>(
-                T::max_size);
+            return max_length_delimited_size(
+                calculate_max_map_content_size<KeyType, ValueType>(
+                    T::max_size));
         }
         std::unreachable();
     }
 
     /**
-     * @brief Calculates the maximum size of a map field.
-     *
-     * Packed encoding: [Tag][TotalLength][Count][Key1][Val1][Key2][Val2]...
-     *
-     * @tparam KeyT The key type.
-     * @tparam ValueT The value type.
-     * @param max_elements The maximum number of elements in the map.
+     * @brief Calculates the maximum size of a field, including its tag.
+     * @tparam FieldT The field type.
      * @return The maximum size in bytes.
      */
-    template <typename KeyT, typename ValueT>
-    [[nodiscard]] static consteval std::size_t calculate_max_map_field_size(
-        std::size_t max_elements) noexcept {
-        constexpr std::size_t tag_size = Varint::max_varint_size(MaxTagBits);
-        constexpr std::size_t length_size = Varint::max_size;
-        constexpr std::size_t count_size = Varint::max_size;
-        constexpr std::size_t key_size = calculate_max_value_size<KeyT>();
-        constexpr std::size_t value_size = calculate_max_value_size<ValueT>();
+    template <typename FieldT>
+    [[nodiscard]] static consteval std::size_t
+    calculate_max_field_size_type() noexcept {
+        constexpr std::size_t tag_size = max_tag_size<FieldT::field_id>();
+        if constexpr (Crunch::messages::is_array_field_v<FieldT> ||
+                      Crunch::messages::is_map_field_v<FieldT>) {
+            return tag_size + calculate_max_value_size<FieldT>();
+        } else {
+            return tag_size +
+                   calculate_max_value_size<
+                       typename detail::ext<FieldT>::type>();
+        }
+    }
 
-        return tag_size + length_size + count_size +
-               max_elements * (key_size + value_size);
+    /**
+     * @brief Number of packed scalar array elements converted per bulk
+     * Varint call.
+     */
+    static constexpr std::size_t VarintBatchSize = 32;
+
+    /**
+     * @brief Gets the wire type used for a scalar value type.
+     * @tparam T The scalar value type.
+     * @return Fixed32/Fixed64 for floating point, Varint otherwise.
+     */
+    template <typename T>
+    [[nodiscard]] static consteval WireType scalar_wire_type() noexcept {
+        if constexpr (std::is_floating_point_v<T>) {
+            return sizeof(T) == 4 ? WireType::Fixed32 : WireType::Fixed64;
+        } else {
+            return WireType::Varint;
+        }
     }
 
     /**
-     * @brief Calculates the maximum size of a field based on its type.
+     * @brief Whether a field type is a scalar encoded as a Varint.
      * @tparam FieldT The field type.
-     * @return The maximum size in bytes.
      */
     template <typename FieldT>
-    [[nodiscard]] static consteval std::size_t
-    calculate_max_field_size_type() noexcept {
-        if constexpr (Crunch::messages::is_array_field_v<FieldT>) {
-            return calculate_max_array_field_size<typename FieldT::ValueType>(
-                FieldT::max_size);
-        } else if constexpr (Crunch::messages::is_map_field_v<FieldT>) {
-            using KeyType = typename FieldT::PairType::first_type;
-            using ValueType = typename FieldT::PairType::second_type;
-            return calculate_max_map_field_size<KeyType, ValueType>(
-                FieldT::max_size);
+    [[nodiscard]] static consteval bool is_varint_scalar() noexcept {
+        if constexpr (Crunch::fields::is_scalar_v<FieldT>) {
+            return scalar_wire_type<typename FieldT::ValueType>() ==
+                   WireType::Varint;
         } else {
-            using ValueType = typename detail::ext<FieldT>::type;
-            if constexpr (Crunch::fields::is_scalar_v<ValueType>) {
-                return calculate_max_scalar_field_size<ValueType>();
-            } else if constexpr (Crunch::fields::is_string_v<ValueType>) {
-                return calculate_max_string_field_size<ValueType>();
-            } else if constexpr (Crunch::messages::HasCrunchMessageInterface<
-                                     ValueType>) {
-                return calculate_max_nested_message_field_size<ValueType>();
+            return false;
+        }
+    }
+
+    /**
+     * @brief Whether values of type T are ZigZag encoded.
+     * @tparam T The scalar value type.
+     */
+    template <typename T>
+    [[nodiscard]] static consteval bool uses_zigzag() noexcept {
+        if constexpr (Signed != SignedEncoding::ZigZag) {
+            return false;
+        } else if constexpr (std::is_enum_v<T>) {
+            return std::is_signed_v<std::underlying_type_t<T>>;
+        } else {
+            return std::is_integral_v<T> && std::is_signed_v<T>;
+        }
+    }
+
+    /**
+     * @brief Converts a scalar value to the integer carried in its Varint.
+     * @tparam T The scalar value type.
+     * @param value The value to convert.
+     * @return The Varint payload.
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr uint64_t to_varint_value(
+        const T& value) noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            return value ? 1 : 0;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if constexpr (sizeof(T) == 4) {
+                return static_cast<uint64_t>(std::bit_cast<uint32_t>(value));
+            } else {
+                return std::bit_cast<uint64_t>(value);
+            }
+        } else if constexpr (uses_zigzag<T>()) {
+            using U = std::make_unsigned_t<T>;
+            const auto bits = std::bit_cast<U>(value);
+            // All ones for negative values, zero otherwise.
+            const auto sign =
+                static_cast<U>(U{0} - (bits >> (sizeof(U) * 8 - 1)));
+            return static_cast<uint64_t>(static_cast<U>(bits << 1) ^ sign);
+        } else {
+            return static_cast<uint64_t>(
+                std::bit_cast<std::make_unsigned_t<T>>(value));
+        }
+    }
+
+    /**
+     * @brief Converts a decoded Varint payload back to a scalar value.
+     * @tparam T The scalar value type.
+     * @param raw The Varint payload.
+     * @return The scalar value.
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr T from_varint_value(uint64_t raw) noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            return raw != 0;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if constexpr (sizeof(T) == 4) {
+                return std::bit_cast<T>(static_cast<uint32_t>(raw));
+            } else {
+                return std::bit_cast<T>(raw);
             }
+        } else if constexpr (uses_zigzag<T>()) {
+            using U = std::make_unsigned_t<T>;
+            const auto bits = static_cast<U>(raw);
+            const auto sign = static_cast<U>(U{0} - (bits & 1));
+            return std::bit_cast<T>(static_cast<U>((bits >> 1) ^ sign));
+        } else {
+            return std::bit_cast<T>(static_cast<std::make_unsigned_t<T>>(raw));
         }
-        return 0;
     }
 
     /**
@@ -341,21 +565,16 @@ struct TlvLayout {
     [[nodiscard]] static constexpr std::size_t serialize_scalar_value(
         const T& value, std::span<std::byte> output,
         std::size_t offset) noexcept {
-        uint64_t encoded_val = 0;
-        if constexpr (std::is_same_v<T, bool>) {
-            encoded_val = value ? 1 : 0;
-        } else if constexpr (std::is_floating_point_v<T>) {
-            if constexpr (sizeof(T) == 4) {
-                encoded_val =
-                    static_cast<uint64_t>(std::bit_cast<uint32_t>(value));
-            } else {
-                encoded_val = std::bit_cast<uint64_t>(value);
-            }
+        if constexpr (std::is_floating_point_v<T>) {
+            const auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(
+                Crunch::LittleEndian(value));
+            std::ranges::copy(bytes, output.begin() +
+                                         static_cast<std::ptrdiff_t>(offset));
+            return offset + sizeof(T);
         } else {
-            encoded_val = static_cast<uint64_t>(
-                std::bit_cast<std::make_unsigned_t<T>>(value));
+            return offset +
+                   Varint::encode(to_varint_value(value), output, offset);
         }
-        return offset + Varint::encode(encoded_val, output, offset);
     }
 
     /**
@@ -377,32 +596,211 @@ struct TlvLayout {
     }
 
     /**
-     * @brief Fixes up a length-prefixed field by encoding actual length and
-     *        shifting content if needed.
+     * @brief Content sizes of the length-prefixed values in one message, in
+     * the order Serialize writes them.
+     *
+     * Filled by a sizing pass before serialization so each length prefix is
+     * written once, at its final size, and no content has to be shifted.
+     */
+    struct LengthPrefixes {
+        /// Empty to only measure sizes without recording them.
+        std::span<uint32_t> sizes;
+        std::size_t next = 0;
+    };
+
+    /**
+     * @brief Counts the length prefixes a value (no tag) can need at most.
+     * @tparam T The value type.
+     * @return The maximum number of length prefixes.
+     */
+    template <typename T>
+    [[nodiscard]] static consteval std::size_t
+    max_value_length_prefixes() noexcept {
+        if constexpr (Crunch::messages::HasCrunchMessageInterface<T>) {
+            return 1 + max_message_length_prefixes<T>();
+        } else if constexpr (Crunch::messages::is_array_field_v<T>) {
+            return 1 + T::max_size *
+                           max_value_length_prefixes<typename T::ValueType>();
+        } else if constexpr (Crunch::messages::is_map_field_v<T>) {
+            using KeyType = typename T::PairType::first_type;
+            using ValueType = typename T::PairType::second_type;
+            return 1 + T::max_size * (max_value_length_prefixes<KeyType>() +
+                                      max_value_length_prefixes<ValueType>());
+        } else {
+            // Strings know their length up front; scalars have none.
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Counts the length prefixes a field can need at most.
+     * @tparam FieldT The field type.
+     * @return The maximum number of length prefixes.
+     */
+    template <typename FieldT>
+    [[nodiscard]] static consteval std::size_t
+    max_field_length_prefixes() noexcept {
+        if constexpr (Crunch::messages::is_array_field_v<FieldT> ||
+                      Crunch::messages::is_map_field_v<FieldT>) {
+            return max_value_length_prefixes<FieldT>();
+        } else {
+            return max_value_length_prefixes<
+                typename detail::ext<FieldT>::type>();
+        }
+    }
+
+    /**
+     * @brief Counts the length prefixes a message's fields can need at most.
+     * @tparam Message The message type.
+     * @return The maximum number of length prefixes.
+     */
+    template <typename Message>
+    [[nodiscard]] static consteval std::size_t
+    max_message_length_prefixes() noexcept {
+        using FieldsTuple = std::remove_cvref_t<
+            decltype(std::declval<Message>().get_fields())>;
+        return []<std::size_t... Is>(std::index_sequence<Is...>) {
+            return (max_field_length_prefixes<std::remove_cvref_t<
+                        std::tuple_element_t<Is, FieldsTuple>>>() +
+                    ... + 0);
+        }(std::make_index_sequence<std::tuple_size_v<FieldsTuple>>{});
+    }
+
+    /**
+     * @brief Computes the encoded size of a value without a tag.
      *
-     * When serializing length-delimited content, we reserve Varint::max_size
-     * for the length. After writing content, we encode the actual length and
-     * shift the content back if the varint was smaller than reserved.
+     * Records the content size of every length-prefixed value it visits in
+     * `lengths`, in the same order the serialize pass consumes them.
      *
+     * @tparam FieldT The field type.
+     * @param field The value to measure.
+     * @param lengths The content sizes being recorded.
+     * @return The size in bytes.
+     */
+    template <typename FieldT>
+    [[nodiscard]] static constexpr std::size_t value_size(
+        const FieldT& field, LengthPrefixes& lengths) noexcept {
+        if constexpr (Crunch::fields::is_scalar_v<FieldT>) {
+            using T = typename FieldT::ValueType;
+            if constexpr (std::is_floating_point_v<T>) {
+                return sizeof(T);
+            } else {
+                return Varint::size(to_varint_value(field.get()));
+            }
+        } else if constexpr (Crunch::fields::is_string_v<FieldT>) {
+            const std::size_t len = field.get().size();
+            return Varint::size(len) + len;
+        } else {
+            const std::size_t slot = lengths.next++;
+            std::size_t content_size = 0;
+            if constexpr (Crunch::messages::HasCrunchMessageInterface<
+                              FieldT>) {
+                content_size = message_content_size(field, lengths);
+            } else if constexpr (Crunch::messages::is_array_field_v<FieldT>) {
+                content_size = array_content_size(field, lengths);
+            } else if constexpr (Crunch::messages::is_map_field_v<FieldT>) {
+                content_size = map_content_size(field, lengths);
+            }
+            if (!lengths.sizes.empty()) {
+                lengths.sizes[slot] = static_cast<uint32_t>(content_size);
+            }
+            return Varint::size(content_size) + content_size;
+        }
+    }
+
+    /**
+     * @brief Computes the encoded size of array content (count + elements).
+     * @tparam FieldT The array field type.
+     * @param field The array field instance.
+     * @param lengths The content sizes being recorded.
+     * @return The size in bytes.
+     */
+    template <typename FieldT>
+    [[nodiscard]] static constexpr std::size_t array_content_size(
+        const FieldT& field, LengthPrefixes& lengths) noexcept {
+        using ElemT = typename FieldT::ValueType;
+        std::size_t size = Varint::size(field.size());
+        if constexpr (Crunch::fields::is_scalar_v<ElemT> &&
+                      !is_varint_scalar<ElemT>()) {
+            return size + field.size() * sizeof(typename ElemT::ValueType);
+        } else {
+            for (const auto& item : field) {
+                size += value_size(item, lengths);
+            }
+            return size;
+        }
+    }
+
+    /**
+     * @brief Computes the encoded size of map content (count + pairs).
+     * @tparam FieldT The map field type.
+     * @param field The map field instance.
+     * @param lengths The content sizes being recorded.
+     * @return The size in bytes.
+     */
+    template <typename FieldT>
+    [[nodiscard]] static constexpr std::size_t map_content_size(
+        const FieldT& field, LengthPrefixes& lengths) noexcept {
+        std::size_t size = Varint::size(field.size());
+        for (const auto& item : field) {
+            size += value_size(item.first, lengths);
+            size += value_size(item.second, lengths);
+        }
+        return size;
+    }
+
+    /**
+     * @brief Computes the encoded size of a field, including its tag.
+     * @tparam FieldT The field type.
+     * @param field The field instance.
+     * @param lengths The content sizes being recorded.
+     * @return The size in bytes, or 0 if the field is not set.
+     */
+    template <typename FieldT>
+    [[nodiscard]] static constexpr std::size_t field_size(
+        const FieldT& field, LengthPrefixes& lengths) noexcept {
+        constexpr std::size_t tag_size = Varint::size(
+            static_cast<uint64_t>(FieldT::field_id) << WireTypeBits);
+        if constexpr (Crunch::messages::is_array_field_v<FieldT> ||
+                      Crunch::messages::is_map_field_v<FieldT>) {
+            return field.empty() ? 0 : tag_size + value_size(field, lengths);
+        } else {
+            return field.set_ ? tag_size + value_size(field.value_, lengths)
+                              : 0;
+        }
+    }
+
+    /**
+     * @brief Computes the encoded size of a message's fields.
+     * @tparam Message The message type.
+     * @param msg The message instance.
+     * @param lengths The content sizes being recorded.
+     * @return The size in bytes.
+     */
+    template <typename Message>
+    [[nodiscard]] static constexpr std::size_t message_content_size(
+        const Message& msg, LengthPrefixes& lengths) noexcept {
+        std::size_t size = 0;
+        std::apply(
+            [&](const auto&... fields) {
+                ((size += field_size(fields, lengths)), ...);
+            },
+            msg.get_fields());
+        return size;
+    }
+
+    /**
+     * @brief Writes the next recorded content size as a length prefix.
      * @param output The output buffer.
-     * @param len_offset Offset where the length varint should be written.
-     * @param content_start Offset where content begins (after reserved space).
-     * @param offset Current offset (end of content).
-     * @return The updated offset after shifting.
-     */
-    [[nodiscard]] static constexpr std::size_t fixup_length_prefix(
-        std::span<std::byte> output, std::size_t len_offset,
-        std::size_t content_start, std::size_t offset) noexcept {
-        const std::size_t content_size = offset - content_start;
-        const std::size_t actual_len_varint_size = Varint::size(content_size);
-        if (actual_len_varint_size < Varint::max_size) {
-            const std::size_t shift = Varint::max_size - actual_len_varint_size;
-            std::memmove(output.data() + len_offset + actual_len_varint_size,
-                         output.data() + content_start, content_size);
-            offset -= shift;
-        }
-        Varint::encode(content_size, output, len_offset);
-        return offset;
+     * @param offset The current offset.
+     * @param lengths The recorded content sizes.
+     * @return The updated offset.
+     */
+    [[nodiscard]] static constexpr std::size_t write_length_prefix(
+        std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
+        const uint32_t content_size = lengths.sizes[lengths.next++];
+        return offset + Varint::encode(content_size, output, offset);
     }
 
     /**
@@ -411,21 +809,16 @@ struct TlvLayout {
      * @param value The message to serialize.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename T>
     [[nodiscard]] static constexpr std::size_t serialize_nested_message(
-        const T& value, std::span<std::byte> output,
-        std::size_t offset) noexcept {
-        const std::size_t len_offset = offset;
-        offset += Varint::max_size;
-
-        const std::size_t content_start = offset;
-        const std::size_t msg_size = serialize_fields_helper(
-            value.get_fields(), output.subspan(content_start), 0);
-        offset += msg_size;
-
-        return fixup_length_prefix(output, len_offset, content_start, offset);
+        const T& value, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
+        offset = write_length_prefix(output, offset, lengths);
+        return serialize_fields_helper(value.get_fields(), output, offset,
+                                       lengths);
     }
 
     /**
@@ -434,31 +827,37 @@ struct TlvLayout {
      * @param field The array field instance.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename FieldT>
     [[nodiscard]] static constexpr std::size_t serialize_array_content(
-        const FieldT& field, std::span<std::byte> output,
-        std::size_t offset) noexcept {
+        const FieldT& field, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
         using ElemT = typename FieldT::ValueType;
 
         // Write element count
         offset += Varint::encode(field.size(), output, offset);
 
+        // Packed integers are encoded in batches with the bulk Varint encoder
+        if constexpr (is_varint_scalar<ElemT>()) {
+            std::array<uint64_t, VarintBatchSize> batch{};
+            std::size_t pending = 0;
+            for (const auto& item : field) {
+                batch[pending++] = to_varint_value(item.get());
+                if (pending == batch.size()) {
+                    offset += Varint::encode_n(batch, output, offset);
+                    pending = 0;
+                }
+            }
+            offset += Varint::encode_n(std::span{batch}.first(pending), output,
+                                       offset);
+            return offset;
+        }
+
         // Serialize elements
         for (const auto& item : field) {
-            if constexpr (Crunch::fields::is_scalar_v<ElemT>) {
-                offset = serialize_scalar_value(item.get(), output, offset);
-            } else if constexpr (Crunch::fields::is_string_v<ElemT>) {
-                offset = serialize_string_value(item, output, offset);
-            } else if constexpr (Crunch::messages::HasCrunchMessageInterface<
-                                     ElemT>) {
-                offset = serialize_nested_message(item, output, offset);
-            } else if constexpr (Crunch::messages::is_array_field_v<ElemT>) {
-                offset = serialize_array_value(item, output, offset);
-            } else if constexpr (Crunch::messages::is_map_field_v<ElemT>) {
-                offset = serialize_map_value(item, output, offset);
-            }
+            offset = serialize_value_without_tag(item, output, offset, lengths);
         }
         return offset;
     }
@@ -469,19 +868,19 @@ struct TlvLayout {
      * @param field The array field instance.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename FieldT>
     [[nodiscard]] static constexpr std::size_t serialize_array_value(
-        const FieldT& field, std::span<std::byte> output,
-        std::size_t offset) noexcept {
-        const std::size_t len_offset = offset;
-        offset += Varint::max_size;
-        const std::size_t content_start = offset;
-
-        offset = serialize_array_content(field, output, offset);
-
-        return fixup_length_prefix(output, len_offset, content_start, offset);
+        const FieldT& field, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
+        const std::size_t content_size = lengths.sizes[lengths.next];
+        offset = write_length_prefix(output, offset, lengths);
+        // End the span at the array's last byte: Varint::encode_n may store
+        // a whole word past its last Varint.
+        return serialize_array_content(
+            field, output.first(offset + content_size), offset, lengths);
     }
 
     /**
@@ -497,15 +896,16 @@ struct TlvLayout {
      * @param field The array field instance.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename FieldT>
     [[nodiscard]] static constexpr std::size_t serialize_array_field(
-        const FieldT& field, std::span<std::byte> output,
-        std::size_t offset) noexcept {
+        const FieldT& field, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
         const FieldId id = field.field_id;
         offset = write_tag(id, WireType::LengthDelimited, output, offset);
-        return serialize_array_value(field, output, offset);
+        return serialize_array_value(field, output, offset, lengths);
     }
 
     /**
@@ -514,23 +914,24 @@ struct TlvLayout {
      * @param field The field to serialize.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename FieldT>
     [[nodiscard]] static constexpr std::size_t serialize_value_without_tag(
-        const FieldT& field, std::span<std::byte> output,
-        std::size_t offset) noexcept {
+        const FieldT& field, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
         if constexpr (Crunch::fields::is_scalar_v<FieldT>) {
             return serialize_scalar_value(field.get(), output, offset);
         } else if constexpr (Crunch::fields::is_string_v<FieldT>) {
             return serialize_string_value(field, output, offset);
         } else if constexpr (Crunch::messages::HasCrunchMessageInterface<
                                  FieldT>) {
-            return serialize_nested_message(field, output, offset);
+            return serialize_nested_message(field, output, offset, lengths);
         } else if constexpr (Crunch::messages::is_array_field_v<FieldT>) {
-            return serialize_array_value(field, output, offset);
+            return serialize_array_value(field, output, offset, lengths);
         } else if constexpr (Crunch::messages::is_map_field_v<FieldT>) {
-            return serialize_map_value(field, output, offset);
+            return serialize_map_value(field, output, offset, lengths);
         }
         return offset;
     }
@@ -541,12 +942,13 @@ struct TlvLayout {
      * @param field The map field instance.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename FieldT>
     [[nodiscard]] static constexpr std::size_t serialize_map_content(
-        const FieldT& field, std::span<std::byte> output,
-        std::size_t offset) noexcept {
+        const FieldT& field, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
         using KeyFieldT = typename FieldT::PairType::first_type;
         using ValueFieldT = typename FieldT::PairType::second_type;
 
@@ -558,9 +960,9 @@ struct TlvLayout {
             field.begin(), field.end(), offset,
             [&](std::size_t off, const auto& item) {
                 off = serialize_value_without_tag<KeyFieldT>(item.first, output,
-                                                             off);
-                return serialize_value_without_tag<ValueFieldT>(item.second,
-                                                                output, off);
+                                                             off, lengths);
+                return serialize_value_without_tag<ValueFieldT>(
+                    item.second, output, off, lengths);
             });
     }
 
@@ -570,19 +972,15 @@ struct TlvLayout {
      * @param field The map field instance.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename FieldT>
     [[nodiscard]] static constexpr std::size_t serialize_map_value(
-        const FieldT& field, std::span<std::byte> output,
-        std::size_t offset) noexcept {
-        const std::size_t len_offset = offset;
-        offset += Varint::max_size;
-        const std::size_t content_start = offset;
-
-        offset = serialize_map_content(field, output, offset);
-
-        return fixup_length_prefix(output, len_offset, content_start, offset);
+        const FieldT& field, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
+        offset = write_length_prefix(output, offset, lengths);
+        return serialize_map_content(field, output, offset, lengths);
     }
 
     /**
@@ -598,15 +996,16 @@ struct TlvLayout {
      * @param field The map field instance.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename FieldT>
     [[nodiscard]] static constexpr std::size_t serialize_map_field(
-        const FieldT& field, std::span<std::byte> output,
-        std::size_t offset) noexcept {
+        const FieldT& field, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
         const FieldId id = field.field_id;
         offset = write_tag(id, WireType::LengthDelimited, output, offset);
-        return serialize_map_value(field, output, offset);
+        return serialize_map_value(field, output, offset, lengths);
     }
 
     /**
@@ -615,12 +1014,13 @@ struct TlvLayout {
      * @param field The field instance.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename FieldT>
     [[nodiscard]] static constexpr std::size_t serialize_field(
-        const FieldT& field, std::span<std::byte> output,
-        std::size_t offset) noexcept {
+        const FieldT& field, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
         bool is_set = false;
         if constexpr (Crunch::messages::is_array_field_v<FieldT> ||
                       Crunch::messages::is_map_field_v<FieldT>) {
@@ -636,13 +1036,15 @@ struct TlvLayout {
         const FieldId id = field.field_id;
 
         if constexpr (Crunch::messages::is_array_field_v<FieldT>) {
-            return serialize_array_field(field, output, offset);
+            return serialize_array_field(field, output, offset, lengths);
         } else if constexpr (Crunch::messages::is_map_field_v<FieldT>) {
-            return serialize_map_field(field, output, offset);
+            return serialize_map_field(field, output, offset, lengths);
         } else {
             using ValueType = typename detail::ext<FieldT>::type;
             if constexpr (Crunch::fields::is_scalar_v<ValueType>) {
-                offset = write_tag(id, WireType::Varint, output, offset);
+                offset = write_tag(
+                    id, scalar_wire_type<typename ValueType::ValueType>(),
+                    output, offset);
                 return serialize_scalar_value(field.value_.get(), output,
                                               offset);
             } else if constexpr (Crunch::fields::is_string_v<ValueType>) {
@@ -653,7 +1055,8 @@ struct TlvLayout {
                                      ValueType>) {
                 offset =
                     write_tag(id, WireType::LengthDelimited, output, offset);
-                return serialize_nested_message(field.value_, output, offset);
+                return serialize_nested_message(field.value_, output, offset,
+                                                lengths);
             }
         }
         return offset;
@@ -666,15 +1069,17 @@ struct TlvLayout {
      * @param t The tuple of fields.
      * @param output The output buffer.
      * @param offset The current offset.
+     * @param lengths The recorded content sizes.
      * @return The updated offset.
      */
     template <typename Tuple, std::size_t I = 0>
     [[nodiscard]] static constexpr std::size_t serialize_fields_helper(
-        const Tuple& t, std::span<std::byte> output,
-        std::size_t offset) noexcept {
+        const Tuple& t, std::span<std::byte> output, std::size_t offset,
+        LengthPrefixes& lengths) noexcept {
         if constexpr (I < std::tuple_size_v<std::remove_cvref_t<Tuple>>) {
-            offset = serialize_field(std::get<I>(t), output, offset);
-            return serialize_fields_helper<Tuple, I + 1>(t, output, offset);
+            offset = serialize_field(std::get<I>(t), output, offset, lengths);
+            return serialize_fields_helper<Tuple, I + 1>(t, output, offset,
+                                                         lengths);
         }
         return offset;
     }
@@ -693,24 +1098,40 @@ struct TlvLayout {
                              std::span<const std::byte> input,
                              std::size_t& offset) noexcept {
         using T = typename ElemT::ValueType;
-        const auto res = Varint::decode(input, offset);
-        if (!res) {
-            return Error::deserialization("invalid varint in packed");
+        if constexpr (std::is_floating_point_v<T>) {
+            return read_fixed_value(val_out, input, offset);
+        } else {
+            const auto res = Varint::decode(input, offset);
+            if (!res) {
+                return Error::deserialization("invalid varint in packed");
+            }
+            offset += res->second;
+            val_out = from_varint_value<T>(res->first);
+            return std::nullopt;
         }
-        offset += res->second;
+    }
 
-        if constexpr (std::is_same_v<T, bool>) {
-            val_out = (res->first != 0);
-        } else if constexpr (std::is_floating_point_v<T>) {
-            if constexpr (sizeof(T) == 4) {
-                val_out = std::bit_cast<T>(static_cast<uint32_t>(res->first));
-            } else {
-                val_out = std::bit_cast<T>(res->first);
-            }
-        } else {
-            val_out = std::bit_cast<T>(
-                static_cast<std::make_unsigned_t<T>>(res->first));
+    /**
+     * @brief Reads a Fixed32/Fixed64 floating-point value.
+     * @tparam T The floating-point type.
+     * @param val_out Reference to store the value.
+     * @param input The input buffer.
+     * @param offset Reference to the current offset (updated on success).
+     * @return std::nullopt on success, or Error.
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr std::optional<Error> read_fixed_value(
+        T& val_out, std::span<const std::byte> input,
+        std::size_t& offset) noexcept {
+        if (offset + sizeof(T) > input.size()) {
+            return Error::deserialization("truncated fixed-width value");
         }
+        std::array<std::byte, sizeof(T)> bytes;
+        std::ranges::copy_n(
+            input.begin() + static_cast<std::ptrdiff_t>(offset), sizeof(T),
+            bytes.begin());
+        val_out = Crunch::LittleEndian(std::bit_cast<T>(bytes));
+        offset += sizeof(T);
         return std::nullopt;
     }
 
@@ -748,7 +1169,7 @@ struct TlvLayout {
     [[nodiscard]] static constexpr std::optional<Error>
     deserialize_scalar_value(ElemT& val, std::span<const std::byte> input,
                              std::size_t& offset) noexcept {
-        typename ElemT::ValueType scalar_val;
+        typename ElemT::ValueType scalar_val{};
         if (const auto err =
                 deserialize_scalar_array<ElemT>(scalar_val, input, offset)) {
             return err;
@@ -916,8 +1337,33 @@ struct TlvLayout {
         offset += count_res->second;
         const std::size_t count = static_cast<std::size_t>(count_res->first);
 
+        std::size_t i = 0;
+        // Packed integers are decoded in batches with the bulk Varint decoder.
+        // A batch that fails to decode falls through to the per-element loop
+        // so errors are reported exactly as before.
+        if constexpr (is_varint_scalar<ElemT>()) {
+            using T = typename ElemT::ValueType;
+            std::array<uint64_t, VarintBatchSize> batch{};
+            while (i < count && count <= FieldT::max_size) {
+                const std::size_t n = std::min(batch.size(), count - i);
+                const auto consumed =
+                    Varint::decode_n(input, offset, std::span{batch}.first(n));
+                if (!consumed) {
+                    break;
+                }
+                offset += *consumed;
+                for (std::size_t j = 0; j < n; ++j) {
+                    if (const auto err =
+                            field.add(from_varint_value<T>(batch[j]))) {
+                        return err;
+                    }
+                }
+                i += n;
+            }
+        }
+
         // Deserialize elements
-        for (std::size_t i = 0; i < count; ++i) {
+        for (; i < count; ++i) {
             ElemT elem{};
             if (const auto err =
                     deserialize_value_without_tag<ElemT>(elem, input, offset)) {
@@ -948,7 +1394,34 @@ struct TlvLayout {
     [[nodiscard]] static constexpr std::optional<Error>
     deserialize_message_payload(std::span<const std::byte> input, Message& msg,
                                 std::size_t offset) noexcept {
+        return deserialize_message_payload(input, msg, offset,
+                                           [](std::span<const std::byte>) {});
+    }
+
+    /**
+     * @brief Deserializes a message payload, reporting each decoded field.
+     * @tparam Message The message type.
+     * @tparam Fold Callable accepting `std::span<const std::byte>`.
+     * @param input The input buffer.
+     * @param msg The message to populate.
+     * @param offset The starting offset.
+     * @param fold Called with the tag and value bytes of each decoded field.
+     * @return std::nullopt on success, or Error.
+     */
+    template <typename Message, typename Fold>
+    [[nodiscard]] static constexpr std::optional<Error>
+    deserialize_message_payload(std::span<const std::byte> input, Message& msg,
+                                std::size_t offset, Fold&& fold) noexcept {
+        using Fields = decltype(msg.get_fields());
+        using Dispatch = FieldDispatch<Fields>;
+        const Fields fields = msg.get_fields();
+
+        // Index of the field after the last one decoded. Encoders write
+        // fields in declaration order, so this usually matches the next tag.
+        std::size_t expected = 0;
+
         while (offset < input.size()) {
+            const std::size_t field_start = offset;
             const auto tag_res = Varint::decode(input, offset);
             if (!tag_res) {
                 return Error::deserialization("invalid tag varint");
@@ -957,22 +1430,24 @@ struct TlvLayout {
 
             offset += tag_bytes;
 
-            const uint32_t field_id =
-                static_cast<uint32_t>(tag >> WireTypeBits);
+            const auto field_id = static_cast<FieldId>(
+                static_cast<uint32_t>(tag >> WireTypeBits));
             const WireType wire_type = static_cast<WireType>(tag & 0x07);
 
-            bool found = false;
-            std::optional<Error> err = visit_fields_tlv(
-                msg.get_fields(), static_cast<FieldId>(field_id), wire_type,
-                input, offset, found);
-
-            if (err) {
-                return err;
+            std::size_t index = expected;
+            if (index >= Dispatch::Count || Dispatch::Ids[index] != field_id) {
+                index = Dispatch::index_of(field_id);
+                if (index == Dispatch::Count) {
+                    return Error::deserialization("unknown fields present");
+                }
             }
-            if (!found) {
-                err.emplace(Error::deserialization("unknown fields present"));
+
+            if (auto err = Dispatch::Decoders[index](fields, wire_type, input,
+                                                     offset)) {
                 return err;
             }
+            expected = index + 1;
+            fold(input.subspan(field_start, offset - field_start));
         }
         return std::nullopt;
     }
@@ -1036,6 +1511,17 @@ struct TlvLayout {
         using ValueType = typename detail::ext<FieldT>::type;
         using T = typename ValueType::ValueType;
 
+        if constexpr (std::is_floating_point_v<T>) {
+            if (wire_type != scalar_wire_type<T>()) {
+                return Error::deserialization("float must be fixed-width");
+            }
+            T val;
+            if (auto err = read_fixed_value(val, input, offset)) {
+                return err;
+            }
+            field.set_without_validation(val);
+            return std::nullopt;
+        }
         if (wire_type != WireType::Varint) {
             return Error::deserialization("scalar must be varint");
         }
@@ -1046,22 +1532,9 @@ struct TlvLayout {
         }
         offset += res->second;
 
-        T val;
-        if constexpr (std::is_same_v<T, bool>) {
-            val = (res->first != 0);
-        } else if constexpr (std::is_floating_point_v<T>) {
-            if constexpr (sizeof(T) == 4) {
-                val = std::bit_cast<T>(static_cast<uint32_t>(res->first));
-            } else {
-                val = std::bit_cast<T>(res->first);
-            }
-        } else {
-            val = std::bit_cast<T>(
-                static_cast<std::make_unsigned_t<T>>(res->first));
-        }
         // Deserialize will validate fields after the entire message is
         // deserialized
-        field.set_without_validation(val);
+        field.set_without_validation(from_varint_value<T>(res->first));
         return std::nullopt;
     }
 
@@ -1291,36 +1764,115 @@ struct TlvLayout {
     }
 
     /**
-     * @brief Recursive helper to visit fields in a tuple and find the matching
-     * ID.
-     * @tparam Tuple The tuple of fields.
-     * @tparam I The current index in the tuple.
-     * @param fields_tuple The tuple instance.
-     * @param target_id The Field ID to look for.
-     * @param wt The wire type encountered.
-     * @param input The input buffer.
-     * @param offset Reference to the current offset.
-     * @param found Reference to a bool flag indicating if field was found.
-     * @return std::nullopt on success (or not found yet), or Error.
+     * @brief Compile-time dispatch from a FieldId to the field that owns it.
+     *
+     * Compact ids map through a dense table indexed by `id - MinId`; sparse
+     * ids fall back to a binary search over the sorted ids. Either way the
+     * field is then decoded through a jump table of per-index decoders.
+     *
+     * @tparam Tuple The field tuple type returned by `get_fields()`.
      */
-    template <typename Tuple, std::size_t I = 0>
-    [[nodiscard]] static constexpr std::optional<Error> visit_fields_tlv(
-        Tuple&& fields_tuple, FieldId target_id, WireType wt,
-        std::span<const std::byte> input, std::size_t& offset,
-        bool& found) noexcept {
-        using TupleT = std::remove_cvref_t<Tuple>;
-        if constexpr (I < std::tuple_size_v<TupleT>) {
-            auto& f = std::get<I>(fields_tuple);
-            if (f.field_id == target_id) {
-                found = true;
-                return deserialize_field_value(f, wt, input, offset);
+    template <typename Tuple>
+    struct FieldDispatch {
+        static constexpr std::size_t Count = std::tuple_size_v<Tuple>;
+        static_assert(Count < UINT16_MAX, "too many fields for dispatch");
+
+        /// Field ids in declaration order.
+        static constexpr std::array<FieldId, Count> Ids =
+            []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return std::array<FieldId, Count>{
+                    std::remove_cvref_t<
+                        std::tuple_element_t<Is, Tuple>>::field_id...};
+            }(std::make_index_sequence<Count>{});
+
+        static constexpr FieldId MinId =
+            Count == 0 ? 0 : *std::ranges::min_element(Ids);
+        static constexpr FieldId MaxId =
+            Count == 0 ? 0 : *std::ranges::max_element(Ids);
+        static constexpr std::size_t Span =
+            Count == 0 ? 0 : static_cast<std::size_t>(MaxId - MinId) + 1;
+
+        /// Use the dense table when it is at most a few entries per field.
+        static constexpr bool Dense = Span <= 4 * Count;
+
+        /// Dense: `id - MinId` -> field index, Count for unused ids.
+        static constexpr auto Table = [] {
+            std::array<uint16_t, Dense ? Span : 0> table{};
+            table.fill(static_cast<uint16_t>(Count));
+            if constexpr (Dense) {
+                // Walk backwards so the first field with an id wins.
+                for (std::size_t i = Count; i-- > 0;) {
+                    table[static_cast<std::size_t>(Ids[i] - MinId)] =
+                        static_cast<uint16_t>(i);
+                }
+            }
+            return table;
+        }();
+
+        /// Sparse: (id, field index) sorted by id.
+        static constexpr auto Sorted = [] {
+            std::array<std::pair<FieldId, uint16_t>, Dense ? 0 : Count>
+                sorted{};
+            if constexpr (!Dense) {
+                for (std::size_t i = 0; i < Count; ++i) {
+                    sorted[i] = {Ids[i], static_cast<uint16_t>(i)};
+                }
+                // Ties keep declaration order, so the first field wins.
+                std::ranges::sort(sorted);
+            }
+            return sorted;
+        }();
+
+        /**
+         * @brief Finds the index of the field with the given id.
+         * @param id The Field ID to look for.
+         * @return The field index, or Count if no field has this id.
+         */
+        [[nodiscard]] static constexpr std::size_t index_of(
+            FieldId id) noexcept {
+            if constexpr (Dense) {
+                // Ids below MinId wrap around and fail the bounds check.
+                const std::size_t slot = static_cast<uint32_t>(id) -
+                                         static_cast<uint32_t>(MinId);
+                return slot < Span ? Table[slot] : Count;
+            } else {
+                const auto it = std::ranges::lower_bound(
+                    Sorted, id, {}, &std::pair<FieldId, uint16_t>::first);
+                return it != Sorted.end() && it->first == id ? it->second
+                                                             : Count;
             }
-            return visit_fields_tlv<Tuple, I + 1>(
-                std::forward<Tuple>(fields_tuple), target_id, wt, input, offset,
-                found);
         }
-        return std::nullopt;
-    }
+
+        /**
+         * @brief Decodes the value of the field at index I.
+         * @tparam I The field index.
+         * @param fields The field tuple.
+         * @param wt The wire type encountered.
+         * @param input The input buffer.
+         * @param offset Reference to the current offset.
+         * @return std::nullopt on success, or Error.
+         */
+        template <std::size_t I>
+        [[nodiscard]] static constexpr std::optional<Error> decode_at(
+            const Tuple& fields, WireType wt, std::span<const std::byte> input,
+            std::size_t& offset) noexcept {
+            return deserialize_field_value(std::get<I>(fields), wt, input,
+                                           offset);
+        }
+
+        using Decoder = std::optional<Error> (*)(const Tuple&, WireType,
+                                                 std::span<const std::byte>,
+                                                 std::size_t&) noexcept;
+
+        /// Field index -> decoder for that field.
+        static constexpr std::array<Decoder, Count> Decoders =
+            []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return std::array<Decoder, Count>{&decode_at<Is>...};
+            }(std::make_index_sequence<Count>{});
+    };
 };
 
+using TlvLayout = BasicTlvLayout<SignedEncoding::TwosComplement>;
+using TlvZigZagLayout = BasicTlvLayout<SignedEncoding::ZigZag>;
+
 }  // namespace Crunch::serdes
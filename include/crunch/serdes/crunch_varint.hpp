@@ -1,9 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
+#include <crunch/core/crunch_endian.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <optional>
 #include <span>
+#include <type_traits>
 #include <utility>
 
 namespace Crunch::serdes {
@@ -12,6 +17,12 @@ namespace Crunch::serdes {
  * @brief Utility for Varint encoding/decoding.
  *
  * Implemented as a header-only library to support constexpr evaluation.
+ *
+ * At runtime, decoding reads 8 bytes as one little-endian word and finds the
+ * terminating byte with a mask, so varints of up to 8 bytes decode without a
+ * per-byte loop. The bulk entry points also consume runs of 16 single-byte
+ * varints per step. Constant evaluation, short buffers, and varints longer
+ * than 8 bytes use the byte loop.
  */
 struct Varint {
     /**
@@ -44,28 +55,88 @@ struct Varint {
      */
     static constexpr std::optional<std::pair<uint64_t, std::size_t>> decode(
         std::span<const std::byte> input, std::size_t offset) noexcept {
-        uint64_t value = 0;
-        std::size_t shift = 0;
-        std::size_t bytes_read = 0;
-
-        while (offset + bytes_read < input.size()) {
-            uint8_t byte = static_cast<uint8_t>(input[offset + bytes_read]);
-            bytes_read++;
+        if (!std::is_constant_evaluated() && offset < input.size() &&
+            input.size() - offset >= sizeof(uint64_t)) {
+            const uint64_t word = load_word(input.data() + offset);
+            const uint64_t stops = ~word & ContinuationBits;
+            if (stops != 0) {
+                const auto len =
+                    static_cast<std::size_t>(std::countr_zero(stops)) / 8 + 1;
+                // Keep the bytes up to and including the terminator.
+                const uint64_t kept = word & (stops ^ (stops - 1));
+                return std::make_pair(compact(kept), len);
+            }
+        }
+        return decode_bytewise(input, offset);
+    }
 
-            if (shift >= 64) {
-                // Overflow (more than 10 bytes or too many bits for 64-bit int)
+    /**
+     * @brief Decodes consecutive Varints from a buffer.
+     *
+     * @param input The input buffer.
+     * @param offset The offset to start reading from.
+     * @param values Receives one decoded value per element.
+     * @return std::optional<std::size_t> The total bytes read, or nullopt if
+     * any Varint is invalid or truncated.
+     */
+    static constexpr std::optional<std::size_t> decode_n(
+        std::span<const std::byte> input, std::size_t offset,
+        std::span<uint64_t> values) noexcept {
+        std::size_t pos = offset;
+        std::size_t i = 0;
+        while (i < values.size()) {
+            if (!std::is_constant_evaluated() && pos < input.size() &&
+                input.size() - pos >= 2 * sizeof(uint64_t) &&
+                values.size() - i >= 2 * sizeof(uint64_t)) {
+                const uint64_t lo = load_word(input.data() + pos);
+                const uint64_t hi =
+                    load_word(input.data() + pos + sizeof(uint64_t));
+                if (((lo | hi) & ContinuationBits) == 0) {
+                    // 16 single-byte Varints.
+                    for (std::size_t b = 0; b < sizeof(uint64_t); ++b) {
+                        values[i + b] = (lo >> (8 * b)) & 0xFF;
+                        values[i + b + 8] = (hi >> (8 * b)) & 0xFF;
+                    }
+                    i += 2 * sizeof(uint64_t);
+                    pos += 2 * sizeof(uint64_t);
+                    continue;
+                }
+            }
+            const auto res = decode(input, pos);
+            if (!res) {
                 return std::nullopt;
             }
+            values[i++] = res->first;
+            pos += res->second;
+        }
+        return pos - offset;
+    }
 
-            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
-            shift += 7;
-
-            if ((byte & 0x80) == 0) {
-                return std::make_pair(value, bytes_read);
+    /**
+     * @brief Encodes consecutive values as Varints.
+     *
+     * Unlike encode(), this may write up to 8 bytes past the end of the last
+     * Varint (but never past the end of `output`). Those bytes are scratch, so
+     * callers pass an `output` that ends where the space they own ends.
+     *
+     * @param values The values to encode.
+     * @param output The output buffer.
+     * @param offset The current offset in the buffer.
+     * @return std::size_t The total number of bytes written.
+     */
+    static constexpr std::size_t encode_n(std::span<const uint64_t> values,
+                                          std::span<std::byte> output,
+                                          std::size_t offset) noexcept {
+        std::size_t pos = offset;
+        for (const uint64_t value : values) {
+            if (!std::is_constant_evaluated() && value < (uint64_t{1} << 56) &&
+                output.size() - pos >= sizeof(uint64_t)) {
+                pos += encode_word(value, output.data() + pos);
+            } else {
+                pos += encode(value, output, pos);
             }
         }
-        // Buffer ended before Varint terminated
-        return std::nullopt;
+        return pos - offset;
     }
 
     /**
@@ -101,6 +172,81 @@ struct Varint {
     static consteval std::size_t max_varint_size(std::size_t value_bits) {
         return (value_bits + 6) / 7;
     }
+
+   private:
+    static constexpr uint64_t ContinuationBits = 0x8080808080808080ULL;
+
+    /**
+     * @brief Loads 8 bytes as a little-endian word.
+     */
+    static uint64_t load_word(const std::byte* p) noexcept {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        return Crunch::LittleEndian(word);
+    }
+
+    /**
+     * @brief Packs the 7-bit groups of up to 8 Varint bytes into one value.
+     * @param word The Varint bytes as a little-endian word, with bytes past
+     * the terminator cleared.
+     */
+    static constexpr uint64_t compact(uint64_t word) noexcept {
+        uint64_t x = word & 0x7F7F7F7F7F7F7F7FULL;
+        x = ((x & 0x7F007F007F007F00ULL) >> 1) | (x & 0x007F007F007F007FULL);
+        x = ((x & 0x3FFF00003FFF0000ULL) >> 2) | (x & 0x00003FFF00003FFFULL);
+        x = ((x & 0x0FFFFFFF00000000ULL) >> 4) | (x & 0x000000000FFFFFFFULL);
+        return x;
+    }
+
+    /**
+     * @brief Encodes a value below 2^56 with a single 8-byte store.
+     * @return The Varint length in bytes.
+     */
+    static std::size_t encode_word(uint64_t value, std::byte* out) noexcept {
+        // Spread the 7-bit groups into separate bytes (inverse of compact).
+        uint64_t x = value;
+        x = ((x & 0x00FFFFFFF0000000ULL) << 4) | (x & 0x000000000FFFFFFFULL);
+        x = ((x & 0x0FFFC0000FFFC000ULL) << 2) | (x & 0x00003FFF00003FFFULL);
+        x = ((x & 0x3F803F803F803F80ULL) << 1) | (x & 0x007F007F007F007FULL);
+
+        const auto bits = static_cast<std::size_t>(std::bit_width(value));
+        const std::size_t len = std::max<std::size_t>(1, (bits + 6) / 7);
+        x |= ContinuationBits & ((uint64_t{1} << (8 * (len - 1))) - 1);
+
+        const uint64_t le = Crunch::LittleEndian(x);
+        std::memcpy(out, &le, sizeof(le));
+        return len;
+    }
+
+    /**
+     * @brief Byte-at-a-time Varint decode. Usable in constant expressions.
+     */
+    static constexpr std::optional<std::pair<uint64_t, std::size_t>>
+    decode_bytewise(std::span<const std::byte> input,
+                    std::size_t offset) noexcept {
+        uint64_t value = 0;
+        std::size_t shift = 0;
+        std::size_t bytes_read = 0;
+
+        while (offset + bytes_read < input.size()) {
+            uint8_t byte = static_cast<uint8_t>(input[offset + bytes_read]);
+            bytes_read++;
+
+            if (shift >= 64) {
+                // Overflow (more than 10 bytes or too many bits for 64-bit int)
+                return std::nullopt;
+            }
+
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            shift += 7;
+
+            if ((byte & 0x80) == 0) {
+                return std::make_pair(value, bytes_read);
+            }
+        }
+        // Buffer ended before Varint terminated
+        return std::nullopt;
+    }
 };
 
 }  // namespace Crunch::serdes
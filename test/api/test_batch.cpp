@@ -0,0 +1,169 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+#include <optional>
+#include <span>
+#include <vector>
+
+using namespace Crunch;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct Tick {
+    CRUNCH_MESSAGE_FIELDS(seq, price, venue, fills);
+    static constexpr MessageId message_id = 0xB001;
+    Field<1, Required, UInt32<None>> seq;
+    Field<2, Optional, Float64<None>> price;
+    Field<3, Optional, String<8, None>> venue;
+    ArrayField<4, Int32<LessThan<1000>>, 6, None> fills;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const Tick&) const = default;
+};
+
+TEMPLATE_TEST_CASE("Batch APIs match per-message Serialize/Deserialize",
+                   "[batch]", serdes::PackedLayout, serdes::Aligned32Layout,
+                   serdes::Aligned64Layout, serdes::TlvLayout) {
+    constexpr std::size_t FrameSize =
+        GetBuffer<Tick, integrity::CRC32C, TestType>().data.size();
+    constexpr std::size_t Count = 9;
+    std::vector<Tick> ticks(Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        REQUIRE_FALSE(
+            ticks[i].seq.set(static_cast<uint32_t>(i + 100)).has_value());
+        if (i % 2 == 0) {
+            REQUIRE_FALSE(
+                ticks[i].price.set(1.25 * static_cast<double>(i)).has_value());
+        }
+        if (i % 3 == 0) {
+            REQUIRE_FALSE(ticks[i].venue.set("XNAS").has_value());
+        }
+        for (std::size_t j = 0; j < i % 5; ++j) {
+            REQUIRE_FALSE(
+                ticks[i].fills.add(static_cast<int32_t>(j * 10)).has_value());
+        }
+    }
+
+    std::vector<std::byte> arena(Count * FrameSize);
+    std::vector<std::size_t> sizes(Count);
+    const auto total = SerializeBatch<Tick, integrity::CRC32C, TestType>(
+        std::span<const Tick>{ticks}, arena, sizes);
+    REQUIRE(total.has_value());
+
+    std::size_t offset = 0;
+    std::vector<std::span<const std::byte>> frames;
+    for (std::size_t i = 0; i < Count; ++i) {
+        auto buffer = GetBuffer<Tick, integrity::CRC32C, TestType>();
+        REQUIRE_FALSE(Serialize(buffer, ticks[i]).has_value());
+        const auto expected = buffer.serialized_message_span();
+        REQUIRE(sizes[i] == expected.size());
+        REQUIRE(std::equal(expected.begin(), expected.end(),
+                           arena.begin() + static_cast<long>(offset)));
+        frames.emplace_back(arena.data() + offset, sizes[i]);
+        offset += sizes[i];
+    }
+    REQUIRE(total.value() == offset);
+
+    SECTION("from a span of frames") {
+        std::vector<Tick> out(Count);
+        std::vector<std::optional<Error>> errors(Count);
+        const auto failed = DeserializeBatch<Tick, integrity::CRC32C, TestType>(
+            frames, out, errors);
+        REQUIRE(failed.value() == 0);
+        REQUIRE(out == ticks);
+    }
+
+    SECTION("from a packed arena") {
+        std::vector<Tick> out(Count);
+        std::vector<std::optional<Error>> errors(Count);
+        const auto failed = DeserializeBatch<Tick, integrity::CRC32C, TestType>(
+            std::span<const std::byte>{arena.data(), offset}, sizes, out,
+            errors);
+        REQUIRE(failed.value() == 0);
+        REQUIRE(out == ticks);
+    }
+}
+
+TEST_CASE("DeserializeBatch reports errors per frame", "[batch]") {
+    using Integrity = integrity::CRC32C;
+    using Serdes = serdes::PackedLayout;
+    std::vector<Tick> ticks(4);
+    for (uint32_t i = 0; i < 4; ++i) {
+        REQUIRE_FALSE(ticks[i].seq.set(i + 100).has_value());
+        REQUIRE_FALSE(ticks[i].fills.add(int32_t{7}).has_value());
+    }
+    std::vector<std::byte> arena(
+        4 * GetBuffer<Tick, Integrity, Serdes>().data.size());
+    std::vector<std::size_t> sizes(4);
+    REQUIRE(SerializeBatch<Tick, Integrity, Serdes>(
+                std::span<const Tick>{ticks}, arena, sizes)
+                .has_value());
+
+    // Corrupt a payload byte of the second frame.
+    arena[sizes[0] + StandardHeaderSize + 1] ^= std::byte{0xFF};
+
+    std::vector<Tick> out(4);
+    std::vector<std::optional<Error>> errors(4);
+    const auto failed =
+        DeserializeBatch<Tick, Integrity, Serdes>(arena, sizes, out, errors);
+    REQUIRE(failed.value() == 1);
+    REQUIRE_FALSE(errors[0].has_value());
+    REQUIRE(errors[1].has_value());
+    REQUIRE(errors[1]->code == ErrorCode::IntegrityCheckFailed);
+    REQUIRE_FALSE(errors[2].has_value());
+    REQUIRE_FALSE(errors[3].has_value());
+    REQUIRE(out[3] == ticks[3]);
+}
+
+TEST_CASE("Batch APIs reject undersized outputs", "[batch]") {
+    using Integrity = integrity::CRC16;
+    using Serdes = serdes::PackedLayout;
+    constexpr std::size_t FrameSize =
+        GetBuffer<Tick, Integrity, Serdes>().data.size();
+    std::vector<Tick> ticks(3);
+    for (uint32_t i = 0; i < 3; ++i) {
+        REQUIRE_FALSE(ticks[i].seq.set(i + 100).has_value());
+    }
+    std::vector<std::size_t> sizes(3);
+
+    std::vector<std::byte> small_arena(3 * FrameSize - 1);
+    auto result = SerializeBatch<Tick, Integrity, Serdes>(
+        std::span<const Tick>{ticks}, small_arena, sizes);
+    REQUIRE_FALSE(result.has_value());
+    REQUIRE(result.error().code == ErrorCode::CapacityExceeded);
+
+    std::vector<std::byte> arena(3 * FrameSize);
+    std::vector<std::size_t> few_sizes(2);
+    result = SerializeBatch<Tick, Integrity, Serdes>(
+        std::span<const Tick>{ticks}, arena, few_sizes);
+    REQUIRE_FALSE(result.has_value());
+
+    std::vector<Tick> out(2);
+    std::vector<std::optional<Error>> errors(3);
+    REQUIRE(SerializeBatch<Tick, Integrity, Serdes>(
+                std::span<const Tick>{ticks}, arena, sizes)
+                .has_value());
+    const auto decoded =
+        DeserializeBatch<Tick, Integrity, Serdes>(arena, sizes, out, errors);
+    REQUIRE_FALSE(decoded.has_value());
+}
+
+TEST_CASE("SerializeBatch stops at the first invalid message", "[batch]") {
+    using Integrity = integrity::None;
+    using Serdes = serdes::PackedLayout;
+    std::vector<Tick> ticks(3);
+    REQUIRE_FALSE(ticks[0].seq.set(uint32_t{100}).has_value());
+    REQUIRE_FALSE(ticks[2].seq.set(uint32_t{102}).has_value());
+    std::vector<std::byte> arena(
+        3 * GetBuffer<Tick, Integrity, Serdes>().data.size());
+    std::vector<std::size_t> sizes(3);
+    const auto result = SerializeBatch<Tick, Integrity, Serdes>(
+        std::span<const Tick>{ticks}, arena, sizes);
+    REQUIRE_FALSE(result.has_value());
+    REQUIRE(result.error().code == ErrorCode::ValidationFailed);
+    REQUIRE(result.error().field_id == 1);
+}
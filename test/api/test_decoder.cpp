@@ -2,6 +2,11 @@
 #include <crunch/crunch.hpp>
 #include <crunch/fields/crunch_scalar.hpp>
 #include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace Crunch;
 using namespace Crunch::messages;
@@ -154,3 +159,217 @@ TEST_CASE("Decoder: Decode returns correct variant type based on message ID",
     REQUIRE_FALSE(std::holds_alternative<MessageA>(msgC));
     REQUIRE_FALSE(std::holds_alternative<MessageB>(msgC));
 }
+
+// Dispatch table selection
+static_assert(detail::MessageDispatch<MessageA, MessageB, MessageC>::Dense);
+
+template <MessageId Id>
+struct Numbered {
+    static constexpr MessageId message_id = Id;
+    Field<1, Required, Int32<None>> value;
+    CRUNCH_MESSAGE_FIELDS(value);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const Numbered&) const = default;
+};
+
+using SparseDecoder =
+    Decoder<serdes::PackedLayout, integrity::CRC16, Numbered<-40>,
+            Numbered<0x7FFFFFFF>, Numbered<1000>, Numbered<3>>;
+static_assert(!detail::MessageDispatch<Numbered<-40>, Numbered<0x7FFFFFFF>,
+                                       Numbered<1000>, Numbered<3>>::Dense);
+static_assert(detail::MessageDispatch<Numbered<-2>, Numbered<0>>::Dense);
+
+template <typename DecoderT, MessageId Id>
+void RequireRoundTrip(DecoderT& decoder, int32_t value) {
+    Numbered<Id> src;
+    REQUIRE_FALSE(src.value.set(value).has_value());
+    auto buffer =
+        GetBuffer<Numbered<Id>, integrity::CRC16, serdes::PackedLayout>();
+    REQUIRE_FALSE(Serialize(buffer, src).has_value());
+
+    typename DecoderT::VariantType msg;
+    REQUIRE_FALSE(
+        decoder.Decode(buffer.serialized_message_span(), msg).has_value());
+    REQUIRE(std::holds_alternative<Numbered<Id>>(msg));
+    REQUIRE(std::get<Numbered<Id>>(msg) == src);
+}
+
+template <typename DecoderT>
+void RequireUnknown(DecoderT& decoder, MessageId id) {
+    std::array<std::byte, StandardHeaderSize + 10> buffer{};
+    buffer[0] = static_cast<std::byte>(CrunchVersion);
+    buffer[1] = static_cast<std::byte>(serdes::PackedLayout::GetFormat());
+    const MessageId le_id = LittleEndian(id);
+    std::memcpy(buffer.data() + 2, &le_id, sizeof(MessageId));
+
+    typename DecoderT::VariantType msg;
+    const auto result = decoder.Decode(std::span{buffer}, msg);
+    REQUIRE(result.has_value());
+    REQUIRE(result->code == ErrorCode::InvalidMessageId);
+}
+
+TEST_CASE("Decoder: sparse message IDs dispatch by sorted search",
+          "[decoder]") {
+    SparseDecoder decoder;
+    RequireRoundTrip<SparseDecoder, -40>(decoder, 1);
+    RequireRoundTrip<SparseDecoder, 0x7FFFFFFF>(decoder, 2);
+    RequireRoundTrip<SparseDecoder, 1000>(decoder, 3);
+    RequireRoundTrip<SparseDecoder, 3>(decoder, 4);
+    for (MessageId id : {-41, -39, 0, 4, 999, 0x7FFFFFFE,
+                         std::numeric_limits<MessageId>::min()}) {
+        RequireUnknown(decoder, id);
+    }
+}
+
+namespace {
+template <std::size_t... Is>
+auto MakeWideDecoder(std::index_sequence<Is...>)
+    -> Decoder<serdes::PackedLayout, integrity::CRC16,
+               Numbered<static_cast<MessageId>(500 + 2 * Is)>...>;
+}  // namespace
+
+using WideDecoder = decltype(MakeWideDecoder(std::make_index_sequence<120>{}));
+
+TEST_CASE("Decoder: dense message IDs dispatch by table", "[decoder]") {
+    WideDecoder decoder;
+    RequireRoundTrip<WideDecoder, 500>(decoder, -1);
+    RequireRoundTrip<WideDecoder, 620>(decoder, 7);
+    RequireRoundTrip<WideDecoder, 738>(decoder, 9);
+    for (MessageId id : {499, 501, 621, 739, 740, -500,
+                         std::numeric_limits<MessageId>::max()}) {
+        RequireUnknown(decoder, id);
+    }
+}
+
+// The Decoder carries no per-instance storage.
+static_assert(std::is_empty_v<TestDecoder>);
+static_assert(std::is_empty_v<WideDecoder>);
+
+TEST_CASE("Decoder: failed decode leaves a default message of the header type",
+          "[decoder]") {
+    Numbered<3> src;
+    REQUIRE_FALSE(src.value.set(77).has_value());
+    auto buffer =
+        GetBuffer<Numbered<3>, integrity::CRC16, serdes::PackedLayout>();
+    REQUIRE_FALSE(Serialize(buffer, src).has_value());
+    buffer.data[StandardHeaderSize + 1] ^= std::byte{0x01};
+
+    const SparseDecoder decoder;
+    SparseDecoder::VariantType msg{std::in_place_type<Numbered<1000>>};
+    REQUIRE(std::get<Numbered<1000>>(msg).value.set(5) == std::nullopt);
+
+    const auto result = decoder.Decode(buffer.serialized_message_span(), msg);
+    REQUIRE(result.has_value());
+    REQUIRE(result->code == ErrorCode::IntegrityCheckFailed);
+    REQUIRE(std::holds_alternative<Numbered<3>>(msg));
+    REQUIRE(std::get<Numbered<3>>(msg) == Numbered<3>{});
+}
+
+using TlvDecoder =
+    Decoder<serdes::TlvLayout, integrity::CRC32C, MessageA, MessageC>;
+
+// Dispatch requires a handler for every message type.
+static_assert(!requires(const TlvDecoder& d, TlvDecoder::Storage& s) {
+    d.Dispatch(std::span<const std::byte>{}, s, [](MessageA&) {});
+});
+
+TEST_CASE("Decoder: Dispatch calls the handler for the decoded type",
+          "[decoder]") {
+    const TlvDecoder decoder;
+    TlvDecoder::Storage storage;
+
+    MessageA a;
+    REQUIRE_FALSE(a.value.set(11).has_value());
+    auto buffer_a = GetBuffer<MessageA, integrity::CRC32C, serdes::TlvLayout>();
+    REQUIRE_FALSE(Serialize(buffer_a, a).has_value());
+
+    MessageC c_set;
+    REQUIRE_FALSE(c_set.value.set(22).has_value());
+    auto buffer_c_set =
+        GetBuffer<MessageC, integrity::CRC32C, serdes::TlvLayout>();
+    REQUIRE_FALSE(Serialize(buffer_c_set, c_set).has_value());
+
+    const MessageC c_empty;
+    auto buffer_c_empty =
+        GetBuffer<MessageC, integrity::CRC32C, serdes::TlvLayout>();
+    REQUIRE_FALSE(Serialize(buffer_c_empty, c_empty).has_value());
+
+    std::vector<int32_t> seen;
+    auto on_a = [&](MessageA& msg) { seen.push_back(*msg.value.get()); };
+    auto on_c = [&](const MessageC& msg) {
+        seen.push_back(msg.value.get().value_or(-1));
+    };
+
+    for (const auto* buffer :
+         {&buffer_c_set, &buffer_c_empty, &buffer_c_set, &buffer_c_empty}) {
+        REQUIRE_FALSE(decoder
+                          .Dispatch(buffer->serialized_message_span(),
+                                    storage, on_a, on_c)
+                          .has_value());
+    }
+    REQUIRE_FALSE(
+        decoder.Dispatch(buffer_a.serialized_message_span(), storage, on_a,
+                         on_c)
+            .has_value());
+    // An absent optional field must not leak from the previous frame.
+    REQUIRE(seen == std::vector<int32_t>{22, -1, 22, -1, 11});
+    REQUIRE(std::get<MessageA>(storage) == a);
+
+    SECTION("a single generic handler covers every type") {
+        std::size_t calls = 0;
+        REQUIRE_FALSE(decoder
+                          .Dispatch(buffer_a.serialized_message_span(),
+                                    storage, [&](auto&) { ++calls; })
+                          .has_value());
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("no handler runs for a bad frame") {
+        buffer_a.data[StandardHeaderSize] ^= std::byte{0x10};
+        const auto err = decoder.Dispatch(buffer_a.serialized_message_span(),
+                                          storage, on_a, on_c);
+        REQUIRE(err.has_value());
+        REQUIRE(err->code == ErrorCode::IntegrityCheckFailed);
+
+        std::array<std::byte, 3> short_buffer{};
+        REQUIRE(decoder.Dispatch(short_buffer, storage, on_a, on_c)
+                    .has_value());
+        REQUIRE(seen.size() == 5);
+    }
+}
+
+static_assert(OverwritingSerdesPolicy<serdes::PackedLayout, MessageC>);
+static_assert(!OverwritingSerdesPolicy<serdes::TlvLayout, MessageC>);
+
+TEST_CASE("Decoder: Dispatch with a static layout leaves no stale fields",
+          "[decoder]") {
+    const TestDecoder decoder;
+    TestDecoder::Storage storage;
+
+    MessageC c_set;
+    REQUIRE_FALSE(c_set.value.set(22).has_value());
+    auto buffer_c_set =
+        GetBuffer<MessageC, integrity::None, serdes::PackedLayout>();
+    REQUIRE_FALSE(Serialize(buffer_c_set, c_set).has_value());
+
+    const MessageC c_empty;
+    auto buffer_c_empty =
+        GetBuffer<MessageC, integrity::None, serdes::PackedLayout>();
+    REQUIRE_FALSE(Serialize(buffer_c_empty, c_empty).has_value());
+
+    std::vector<int32_t> seen;
+    auto on_c = [&](const MessageC& msg) {
+        seen.push_back(msg.value.get().value_or(-1));
+    };
+    for (const auto* buffer : {&buffer_c_set, &buffer_c_empty}) {
+        REQUIRE_FALSE(decoder
+                          .Dispatch(buffer->serialized_message_span(),
+                                    storage, [](const MessageA&) {},
+                                    [](const MessageB&) {}, on_c)
+                          .has_value());
+    }
+    REQUIRE(seen == std::vector<int32_t>{22, -1});
+    REQUIRE(std::get<MessageC>(storage) == c_empty);
+}
@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
+#include <crunch/crunch_frame_assembler.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+#include <cstring>
+#include <span>
+#include <variant>
+#include <vector>
+
+using namespace Crunch;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct Quote {
+    CRUNCH_MESSAGE_FIELDS(id, price, venue);
+    static constexpr MessageId message_id = 0xA001;
+    Field<1, Required, UInt32<None>> id;
+    Field<2, Required, Int32<None>> price;
+    Field<3, Optional, String<16, None>> venue;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const Quote&) const = default;
+};
+
+struct Heartbeat {
+    CRUNCH_MESSAGE_FIELDS(seq);
+    static constexpr MessageId message_id = 0xA002;
+    Field<1, Required, UInt16<None>> seq;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const Heartbeat&) const = default;
+};
+
+using PackedDecoder =
+    Decoder<serdes::PackedLayout, integrity::CRC16, Quote, Heartbeat>;
+using TlvDecoder =
+    Decoder<serdes::TlvLayout, integrity::CRC32C, Quote, Heartbeat>;
+
+TEMPLATE_TEST_CASE("FrameAssembler reassembles frames from any chunking",
+                   "[FrameAssembler]", PackedDecoder, TlvDecoder) {
+    using Integrity = typename TestType::IntegrityType;
+    using Serdes = typename TestType::SerdesType;
+    std::vector<typename TestType::VariantType> messages;
+    std::vector<std::byte> stream;
+    for (uint16_t i = 0; i < 40; ++i) {
+        if (i % 3 == 0) {
+            Heartbeat hb;
+            REQUIRE_FALSE(hb.seq.set(i).has_value());
+            auto buffer = GetBuffer<Heartbeat, Integrity, Serdes>();
+            REQUIRE_FALSE(Serialize(buffer, hb).has_value());
+            const auto frame = buffer.serialized_message_span();
+            stream.insert(stream.end(), frame.begin(), frame.end());
+            messages.emplace_back(hb);
+            continue;
+        }
+        Quote quote;
+        REQUIRE_FALSE(quote.id.set(i).has_value());
+        REQUIRE_FALSE(quote.price.set(int32_t{1} << (i % 31)).has_value());
+        if (i % 2 == 0) {
+            REQUIRE_FALSE(quote.venue.set("XNAS").has_value());
+        }
+        auto buffer = GetBuffer<Quote, Integrity, Serdes>();
+        REQUIRE_FALSE(Serialize(buffer, quote).has_value());
+        const auto frame = buffer.serialized_message_span();
+        stream.insert(stream.end(), frame.begin(), frame.end());
+        messages.emplace_back(quote);
+    }
+    const TestType decoder;
+
+    // The smallest ring forces frames to wrap its end.
+    for (const std::size_t chunk : {std::size_t{1}, std::size_t{7},
+                                    std::size_t{64}, stream.size()}) {
+        FrameAssembler<TestType, TestType::MaxFrameSize> assembler;
+        std::size_t fed = 0;
+        std::size_t decoded = 0;
+        while (decoded < messages.size()) {
+            const std::size_t end = std::min(stream.size(), fed + chunk);
+            fed += assembler.Feed(
+                std::span{stream}.subspan(fed, end - fed));
+            for (;;) {
+                const auto frame = assembler.NextFrame();
+                REQUIRE(frame.has_value());
+                if (frame->empty()) {
+                    break;
+                }
+                typename TestType::VariantType out;
+                REQUIRE_FALSE(decoder.Decode(*frame, out).has_value());
+                REQUIRE(out == messages[decoded]);
+                ++decoded;
+            }
+        }
+        REQUIRE(fed == stream.size());
+        REQUIRE(assembler.size() == 0);
+    }
+}
+
+TEST_CASE("FrameAssembler returns contiguous frames without copying",
+          "[FrameAssembler]") {
+    constexpr std::size_t Count = 40;
+    std::vector<std::byte> stream;
+    for (uint32_t i = 0; i < Count; ++i) {
+        Quote quote;
+        REQUIRE_FALSE(quote.id.set(i).has_value());
+        REQUIRE_FALSE(quote.price.set(static_cast<int32_t>(i * 3)).has_value());
+        auto buffer = GetBuffer<Quote, integrity::CRC32C, serdes::TlvLayout>();
+        REQUIRE_FALSE(Serialize(buffer, quote).has_value());
+        const auto frame = buffer.serialized_message_span();
+        stream.insert(stream.end(), frame.begin(), frame.end());
+    }
+
+    FrameAssembler<TlvDecoder, 4096> assembler;
+    const std::span<std::byte> ring = assembler.WriteSpan();
+    REQUIRE(ring.size() == 4096);
+    REQUIRE(stream.size() <= ring.size());
+
+    // Read straight into the ring, as a socket read would.
+    std::memcpy(ring.data(), stream.data(), stream.size());
+    assembler.Commit(stream.size());
+
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < Count; ++i) {
+        const auto frame = assembler.NextFrame();
+        REQUIRE(frame.has_value());
+        REQUIRE(frame->data() == ring.data() + offset);
+        offset += frame->size();
+    }
+    REQUIRE(offset == stream.size());
+    REQUIRE(assembler.NextFrame()->empty());
+}
+
+TEST_CASE("FrameAssembler accepts no more than fits", "[FrameAssembler]") {
+    constexpr std::size_t Capacity = PackedDecoder::MaxFrameSize;
+    Quote quote;
+    REQUIRE_FALSE(quote.id.set(uint32_t{7}).has_value());
+    REQUIRE_FALSE(quote.price.set(int32_t{42}).has_value());
+    auto buffer = GetBuffer<Quote, integrity::CRC16, serdes::PackedLayout>();
+    REQUIRE_FALSE(Serialize(buffer, quote).has_value());
+    // Quote is the larger message, so each of its frames fills the ring.
+    const auto one = buffer.serialized_message_span();
+    REQUIRE(one.size() == Capacity);
+    std::vector<std::byte> stream;
+    for (int i = 0; i < 3; ++i) {
+        stream.insert(stream.end(), one.begin(), one.end());
+    }
+
+    FrameAssembler<PackedDecoder, Capacity> assembler;
+    REQUIRE(assembler.Feed(stream) == Capacity);
+    REQUIRE(assembler.Feed(stream) == 0);
+    REQUIRE(assembler.WriteSpan().empty());
+
+    // Taking a frame keeps its bytes until the next NextFrame.
+    const auto frame = assembler.NextFrame();
+    REQUIRE(frame.has_value());
+    REQUIRE_FALSE(frame->empty());
+    REQUIRE(assembler.Feed(stream) == 0);
+    REQUIRE(assembler.NextFrame().has_value());
+    REQUIRE(assembler.Feed(std::span{stream}.subspan(Capacity)) ==
+            frame->size());
+
+    assembler.Reset();
+    REQUIRE(assembler.size() == 0);
+    REQUIRE(assembler.WriteSpan().size() == Capacity);
+}
+
+TEST_CASE("FrameAssembler skips bytes which cannot start a frame",
+          "[FrameAssembler]") {
+    Quote quote;
+    REQUIRE_FALSE(quote.id.set(uint32_t{1}).has_value());
+    REQUIRE_FALSE(quote.price.set(int32_t{2}).has_value());
+    REQUIRE_FALSE(quote.venue.set("XNAS").has_value());
+    auto buffer = GetBuffer<Quote, integrity::CRC32C, serdes::TlvLayout>();
+    REQUIRE_FALSE(Serialize(buffer, quote).has_value());
+    std::vector<std::byte> stream(3, std::byte{0xEE});
+    const auto frame_bytes = buffer.serialized_message_span();
+    stream.insert(stream.end(), frame_bytes.begin(), frame_bytes.end());
+
+    FrameAssembler<TlvDecoder, 4096> assembler;
+    REQUIRE(assembler.Feed(stream) == stream.size());
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE_FALSE(assembler.NextFrame().has_value());
+    }
+
+    const TlvDecoder decoder;
+    TlvDecoder::VariantType out;
+    const auto frame = assembler.NextFrame();
+    REQUIRE(frame.has_value());
+    REQUIRE_FALSE(decoder.Decode(*frame, out).has_value());
+    REQUIRE(std::get<Quote>(out) == quote);
+}
+
+TEST_CASE("Decoder::FrameLength checks the frame prefix", "[FrameAssembler]") {
+    Heartbeat hb;
+    REQUIRE_FALSE(hb.seq.set(uint16_t{1}).has_value());
+    auto buffer = GetBuffer<Heartbeat, integrity::CRC32C, serdes::TlvLayout>();
+    REQUIRE_FALSE(Serialize(buffer, hb).has_value());
+    const auto frame = buffer.serialized_message_span();
+    const std::vector<std::byte> stream(frame.begin(), frame.end());
+
+    const auto length = TlvDecoder::FrameLength(stream);
+    REQUIRE(length.has_value());
+    REQUIRE(*length == stream.size());
+
+    constexpr std::size_t PrefixSize = serdes::TlvLayout::FramePrefixSize;
+    const std::span<const std::byte> short_prefix =
+        std::span{stream}.first(PrefixSize - 1);
+    REQUIRE_FALSE(TlvDecoder::FrameLength(short_prefix).has_value());
+
+    // A length beyond the largest Heartbeat frame is rejected up front.
+    std::vector<std::byte> oversized = stream;
+    const uint32_t huge = LittleEndian(uint32_t{0x00FFFFFF});
+    std::memcpy(oversized.data() + StandardHeaderSize, &huge, sizeof(huge));
+    REQUIRE(TlvDecoder::FrameLength(oversized).error().code ==
+            ErrorCode::DeserializationError);
+
+    std::vector<std::byte> unknown = stream;
+    unknown[2] = std::byte{0x7F};
+    REQUIRE(TlvDecoder::FrameLength(unknown).error().code ==
+            ErrorCode::InvalidMessageId);
+
+    REQUIRE(PackedDecoder::FrameLength(stream).error().code ==
+            ErrorCode::InvalidFormat);
+}
@@ -0,0 +1,102 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+
+using namespace Crunch;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct FusedInner {
+    CRUNCH_MESSAGE_FIELDS(val);
+    static constexpr MessageId message_id = 0xF001;
+    Field<1, Required, Int32<None>> val;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const FusedInner&) const = default;
+};
+
+struct FusedMessage {
+    CRUNCH_MESSAGE_FIELDS(id, name, inner, samples);
+    static constexpr MessageId message_id = 0xF002;
+    Field<1, Required, Int32<None>> id;
+    Field<2, Optional, String<32, None>> name;
+    Field<3, Optional, FusedInner> inner;
+    ArrayField<4, Int32<None>, 16, None> samples;
+
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const FusedMessage&) const = default;
+};
+
+TEMPLATE_TEST_CASE("Fused deserialize round trips", "[fused]",
+                   serdes::PackedLayout, serdes::Aligned32Layout,
+                   serdes::Aligned64Layout, serdes::TlvLayout) {
+    FusedMessage msg;
+    REQUIRE_FALSE(msg.id.set(1234).has_value());
+    REQUIRE_FALSE(msg.name.set("fused decode").has_value());
+    FusedInner inner;
+    REQUIRE_FALSE(inner.val.set(-99).has_value());
+    msg.inner.set(inner);
+    for (int32_t i = 0; i < 10; ++i) {
+        REQUIRE_FALSE(msg.samples.add(i * 100003).has_value());
+    }
+    auto buffer = GetBuffer<FusedMessage, integrity::CRC32C, TestType>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    FusedMessage fused;
+    REQUIRE_FALSE(DeserializeFused(buffer, fused).has_value());
+    REQUIRE(fused == msg);
+
+    FusedMessage two_pass;
+    REQUIRE_FALSE(Deserialize(buffer, two_pass).has_value());
+    REQUIRE(fused == two_pass);
+}
+
+TEMPLATE_TEST_CASE("Fused deserialize rejects every single-byte corruption",
+                   "[fused]", serdes::PackedLayout, serdes::TlvLayout) {
+    FusedMessage msg;
+    REQUIRE_FALSE(msg.id.set(1234).has_value());
+    REQUIRE_FALSE(msg.name.set("fused decode").has_value());
+    FusedInner inner;
+    REQUIRE_FALSE(inner.val.set(-99).has_value());
+    msg.inner.set(inner);
+    for (int32_t i = 0; i < 10; ++i) {
+        REQUIRE_FALSE(msg.samples.add(i * 100003).has_value());
+    }
+    auto buffer = GetBuffer<FusedMessage, integrity::CRC16, TestType>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    for (std::size_t i = 0; i < buffer.used_bytes; ++i) {
+        CAPTURE(i);
+        auto corrupted = buffer;
+        corrupted.data[i] ^= std::byte{0x5A};
+
+        FusedMessage out = msg;
+        auto result = DeserializeFused(corrupted, out);
+        REQUIRE(result.has_value());
+        REQUIRE(result.value() == Error::integrity());
+        REQUIRE(out == FusedMessage{});
+    }
+}
+
+TEST_CASE("Fused deserialize reports decode errors after checksum passes",
+          "[fused]") {
+    FusedMessage msg;
+    REQUIRE_FALSE(msg.id.set(1234).has_value());
+    auto buffer =
+        GetBuffer<FusedMessage, integrity::CRC32C, serdes::TlvLayout>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    FusedInner wrong;
+    auto result = DeserializeFused(
+        Buffer<FusedInner, integrity::CRC32C, serdes::TlvLayout,
+               decltype(buffer)::Size>{buffer.data, buffer.used_bytes},
+        wrong);
+    REQUIRE(result.has_value());
+    REQUIRE(result.value() == Error::invalid_message_id());
+}
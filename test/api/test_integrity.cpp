@@ -59,3 +59,250 @@ TEMPLATE_TEST_CASE("Parity Integrity", "[integrity]", serdes::PackedLayout,
     REQUIRE(err_result.has_value());
     REQUIRE(err_result.value() == Error::integrity());
 }
+
+namespace {
+// Reference bit-at-a-time CRC-16-CCITT used to check the table-driven engine.
+constexpr uint16_t ReferenceCRC16(std::span<const std::byte> data) {
+    uint16_t crc = 0xFFFF;
+    for (std::byte b : data) {
+        crc ^= static_cast<uint16_t>(static_cast<uint8_t>(b) << 8);
+        for (int i = 0; i < 8; i++) {
+            if (crc & 0x8000) {
+                crc = static_cast<uint16_t>((crc << 1) ^ 0x1021);
+            } else {
+                crc = static_cast<uint16_t>(crc << 1);
+            }
+        }
+    }
+    return crc;
+}
+
+constexpr uint16_t ToU16(std::array<std::byte, 2> crc) {
+    return static_cast<uint16_t>((static_cast<uint16_t>(crc[0]) << 8) |
+                                 static_cast<uint16_t>(crc[1]));
+}
+
+constexpr std::array<std::byte, 9> CheckInput = {
+    std::byte{'1'}, std::byte{'2'}, std::byte{'3'}, std::byte{'4'},
+    std::byte{'5'}, std::byte{'6'}, std::byte{'7'}, std::byte{'8'},
+    std::byte{'9'}};
+}  // namespace
+
+// CRC-16/CCITT-FALSE check value, evaluated at compile time.
+static_assert(ToU16(integrity::CRC16::calculate(CheckInput)) == 0x29B1);
+static_assert(ToU16(integrity::CRC16::calculate({})) == 0xFFFF);
+
+TEST_CASE("CRC16 table engine matches bitwise reference", "[integrity]") {
+    std::array<std::byte, 67> data{};
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::byte>((i * 37 + 11) & 0xFF);
+    }
+
+    // Cover every tail length around the 8-byte slice boundary.
+    for (std::size_t len = 0; len <= data.size(); ++len) {
+        const std::span<const std::byte> input{data.data(), len};
+        REQUIRE(ToU16(integrity::CRC16::calculate(input)) ==
+                ReferenceCRC16(input));
+    }
+}
+
+namespace {
+template <std::size_t N>
+constexpr uint64_t ToU64(std::array<std::byte, N> crc) {
+    uint64_t value = 0;
+    for (std::byte b : crc) {
+        value = (value << 8) | static_cast<uint64_t>(b);
+    }
+    return value;
+}
+}  // namespace
+
+// Published check values, evaluated at compile time via the table engines.
+static_assert(ToU64(integrity::CRC32C::calculate(CheckInput)) == 0xE3069283);
+static_assert(ToU64(integrity::CRC64::calculate(CheckInput)) ==
+              0x995DC9BBDF1939FA);
+static_assert(IntegrityPolicy<integrity::CRC32C>);
+static_assert(IntegrityPolicy<integrity::CRC64>);
+
+TEMPLATE_TEST_CASE("Hardware CRC paths match table engine", "[integrity]",
+                   integrity::CRC32C, integrity::CRC64) {
+    std::array<std::byte, 301> data{};
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::byte>((i * 131 + 7) & 0xFF);
+    }
+
+    constexpr auto compile_time = TestType::calculate(CheckInput);
+    REQUIRE(TestType::calculate(CheckInput) == compile_time);
+
+    // Cover every folding tail length and unaligned starting addresses.
+    for (std::size_t start = 0; start < 3; ++start) {
+        for (std::size_t len = 0; start + len <= data.size(); ++len) {
+            const std::span<const std::byte> input{data.data() + start, len};
+            const auto runtime = TestType::calculate(input);
+            const auto table = [&] {
+                if constexpr (std::is_same_v<TestType, integrity::CRC32C>) {
+                    return integrity::detail::ToBigEndianBytes(
+                        integrity::detail::ReflectedCRCUpdate<
+                            uint32_t, integrity::detail::CRC32CPoly>(
+                            0xFFFFFFFF, input) ^
+                        0xFFFFFFFF);
+                } else {
+                    return integrity::detail::ToBigEndianBytes(
+                        integrity::detail::ReflectedCRCUpdate<
+                            uint64_t, integrity::detail::CRC64Poly>(
+                            ~uint64_t{0}, input) ^
+                        ~uint64_t{0});
+                }
+            }();
+            REQUIRE(runtime == table);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Built-in checksums detect tampering", "[integrity]",
+                   integrity::CRC32C, integrity::CRC64, integrity::XXH3_32,
+                   integrity::XXH3_64) {
+    MyMessage msg;
+    REQUIRE_FALSE(msg.f1.set(10).has_value());
+    auto buffer = GetBuffer<MyMessage, TestType, serdes::TlvLayout>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    MyMessage out_msg;
+    REQUIRE_FALSE(Deserialize(buffer, out_msg).has_value());
+    REQUIRE(out_msg == msg);
+
+    buffer.data[StandardHeaderSize] ^= std::byte{0x01};
+    auto result = Deserialize(buffer, out_msg);
+    REQUIRE(result.has_value());
+    REQUIRE(result.value() == Error::integrity());
+}
+
+namespace {
+constexpr auto HashPattern = [] {
+    std::array<std::byte, 4096> data{};
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::byte>(i * 31 + 7);
+    }
+    return data;
+}();
+
+constexpr uint64_t HashPrefix(std::size_t len) {
+    return ToU64(
+        integrity::XXH3_64::calculate(std::span{HashPattern}.first(len)));
+}
+
+// Expected values from the xxHash 0.8 reference XXH3_64bits().
+constexpr std::array<std::pair<std::size_t, uint64_t>, 24> XXH3Vectors = {{
+    {0, 0x2D06800538D394C2ULL},    {1, 0x4C5CCA45D0F4811FULL},
+    {3, 0x15F7093B173D005CULL},    {4, 0xDCA012F95811B6B9ULL},
+    {8, 0xDEC6A9A43575982EULL},    {9, 0xCBE393399F17FFBDULL},
+    {16, 0x7E484C18D74895D0ULL},   {17, 0x208BDE5EE2BED407ULL},
+    {32, 0x03DF0AC5255D1446ULL},   {33, 0x199A362122D71F46ULL},
+    {64, 0xDD30702AB46B3745ULL},   {65, 0xFAB36B851B94CE20ULL},
+    {96, 0xD245CD2541582982ULL},   {97, 0x60E3E1D0D43785B3ULL},
+    {128, 0xF92B70EAA21A6288ULL},  {129, 0xF8F76713F2BB60FAULL},
+    {200, 0x12FDB864685F344DULL},  {240, 0xCCC7375172C41F03ULL},
+    {241, 0x0B3B630948CE4A00ULL},  {256, 0xEC85B75BAFE6CA74ULL},
+    {1024, 0x23BC880EBF0D29C6ULL}, {1025, 0xC09FDFBC398C7D82ULL},
+    {2048, 0x19F6F9C987331373ULL}, {4096, 0xA3C19F8174CDE0BBULL},
+}};
+}  // namespace
+
+// Compile-time evaluation takes the scalar path.
+static_assert(ToU64(integrity::XXH3_64::calculate(CheckInput)) ==
+              0x72DCB18B67A17DFFULL);
+static_assert(ToU64(integrity::XXH3_32::calculate(CheckInput)) == 0x67A17DFF);
+static_assert(HashPrefix(241) == 0x0B3B630948CE4A00ULL);
+static_assert(HashPrefix(1025) == 0xC09FDFBC398C7D82ULL);
+static_assert(IntegrityPolicy<integrity::XXH3_64>);
+static_assert(IntegrityPolicy<integrity::XXH3_32>);
+
+TEST_CASE("XXH3 matches reference vectors at runtime", "[integrity]") {
+    for (const auto& [len, expected] : XXH3Vectors) {
+        CAPTURE(len);
+        REQUIRE(HashPrefix(len) == expected);
+    }
+}
+
+static_assert(IncrementalIntegrityPolicy<integrity::CRC16>);
+static_assert(IncrementalIntegrityPolicy<integrity::Parity>);
+static_assert(IncrementalIntegrityPolicy<integrity::CRC32C>);
+static_assert(IncrementalIntegrityPolicy<integrity::CRC64>);
+static_assert(!IncrementalIntegrityPolicy<integrity::XXH3_64>);
+static_assert(FoldingSerdesPolicy<serdes::PackedLayout, MyMessage>);
+static_assert(FoldingSerdesPolicy<serdes::Aligned64Layout, MyMessage>);
+static_assert(FoldingSerdesPolicy<serdes::TlvLayout, MyMessage>);
+
+TEMPLATE_TEST_CASE("Incremental checksum matches one-shot", "[integrity]",
+                   integrity::CRC16, integrity::Parity, integrity::CRC32C,
+                   integrity::CRC64) {
+    const std::span<const std::byte> data{HashPattern};
+    for (const std::size_t len : {0UZ, 1UZ, 7UZ, 64UZ, 300UZ, 1031UZ}) {
+        for (const std::size_t chunk : {1UZ, 3UZ, 16UZ, 129UZ}) {
+            CAPTURE(len, chunk);
+            auto state = TestType::init();
+            for (std::size_t i = 0; i < len; i += chunk) {
+                state = TestType::update(
+                    state, data.subspan(i, std::min(chunk, len - i)));
+            }
+            REQUIRE(TestType::finalize(state) ==
+                    TestType::calculate(data.first(len)));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Folded serialization checksum matches one-shot",
+                   "[integrity]", serdes::PackedLayout,
+                   serdes::Aligned32Layout, serdes::Aligned64Layout,
+                   serdes::TlvLayout) {
+    MyMessage msg;
+    REQUIRE_FALSE(msg.f1.set(42).has_value());
+    REQUIRE_FALSE(msg.f2.set(int16_t{-7}).has_value());
+    auto buffer = GetBuffer<MyMessage, integrity::CRC32C, TestType>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    const auto serialized = buffer.serialized_message_span();
+    const auto payload = serialized.first(serialized.size() - 4);
+    const auto checksum = integrity::CRC32C::calculate(payload);
+    REQUIRE(std::equal(checksum.begin(), checksum.end(),
+                       serialized.last(4).begin()));
+
+    MyMessage out_msg;
+    REQUIRE_FALSE(Deserialize(buffer, out_msg).has_value());
+    REQUIRE(out_msg == msg);
+}
+
+static_assert(PatchableIntegrityPolicy<integrity::None>);
+static_assert(PatchableIntegrityPolicy<integrity::CRC16>);
+static_assert(PatchableIntegrityPolicy<integrity::Parity>);
+static_assert(PatchableIntegrityPolicy<integrity::CRC32C>);
+static_assert(PatchableIntegrityPolicy<integrity::CRC64>);
+static_assert(!PatchableIntegrityPolicy<integrity::XXH3_64>);
+
+TEMPLATE_TEST_CASE("Patched checksum matches recalculation", "[integrity]",
+                   integrity::CRC16, integrity::Parity, integrity::CRC32C,
+                   integrity::CRC64) {
+    constexpr std::size_t Len = 1031;
+    std::array<std::byte, Len> data;
+    std::copy_n(HashPattern.begin(), Len, data.begin());
+
+    for (const std::size_t at : {0UZ, 1UZ, 17UZ, 512UZ, Len - 8, Len - 1}) {
+        for (const std::size_t width : {1UZ, 2UZ, 8UZ}) {
+            if (at + width > Len) {
+                continue;
+            }
+            CAPTURE(at, width);
+            const auto before = TestType::calculate(data);
+            std::array<std::byte, 8> old_bytes;
+            std::copy_n(data.begin() + at, width, old_bytes.begin());
+            for (std::size_t i = 0; i < width; ++i) {
+                data[at + i] ^= static_cast<std::byte>(0x5A + i);
+            }
+            const auto patched =
+                TestType::patch(before, std::span{old_bytes}.first(width),
+                                std::span{data}.subspan(at, width),
+                                Len - at - width);
+            REQUIRE(patched == TestType::calculate(data));
+        }
+    }
+}
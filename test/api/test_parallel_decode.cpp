@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
+#include <crunch/crunch_parallel.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+#include <optional>
+#include <span>
+#include <variant>
+#include <vector>
+
+using namespace Crunch;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct Quote {
+    CRUNCH_MESSAGE_FIELDS(seq, bid, ask);
+    static constexpr MessageId message_id = 0xC001;
+    Field<1, Required, UInt32<None>> seq;
+    Field<2, Optional, Float64<None>> bid;
+    Field<3, Optional, Float64<None>> ask;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const Quote&) const = default;
+};
+
+struct Trade {
+    CRUNCH_MESSAGE_FIELDS(seq, qty);
+    static constexpr MessageId message_id = 0xC002;
+    Field<1, Required, UInt32<None>> seq;
+    Field<2, Required, Int32<None>> qty;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const Trade&) const = default;
+};
+
+using Integrity = integrity::CRC32C;
+using Serdes = serdes::TlvLayout;
+using ReplayDecoder = Decoder<Serdes, Integrity, Quote, Trade>;
+
+static_assert(IsDecoder<ReplayDecoder>);
+static_assert(!IsDecoder<Quote>);
+
+constexpr std::size_t FrameSize =
+    std::max(GetBuffer<Quote, Integrity, Serdes>().data.size(),
+             GetBuffer<Trade, Integrity, Serdes>().data.size());
+
+TEST_CASE("DecodeBatchParallel matches serial decoding", "[parallel]") {
+    constexpr std::size_t Count = 1001;
+    // Alternating Quote/Trade frames at a fixed stride.
+    std::vector<std::byte> arena(Count * FrameSize);
+    std::vector<std::span<const std::byte>> frames;
+    std::vector<ReplayDecoder::VariantType> expected;
+    for (std::size_t i = 0; i < Count; ++i) {
+        std::byte* slot = arena.data() + i * FrameSize;
+        const auto seq = static_cast<uint32_t>(i);
+        if (i % 2 == 0) {
+            Quote quote;
+            REQUIRE_FALSE(quote.seq.set(seq).has_value());
+            REQUIRE_FALSE(quote.bid.set(100.0 + seq).has_value());
+            auto buffer = GetBuffer<Quote, Integrity, Serdes>();
+            REQUIRE_FALSE(Serialize(buffer, quote).has_value());
+            std::copy_n(buffer.data.begin(), buffer.used_bytes, slot);
+            frames.emplace_back(slot, buffer.used_bytes);
+            expected.emplace_back(quote);
+        } else {
+            Trade trade;
+            REQUIRE_FALSE(trade.seq.set(seq).has_value());
+            REQUIRE_FALSE(trade.qty.set(-static_cast<int32_t>(i)).has_value());
+            auto buffer = GetBuffer<Trade, Integrity, Serdes>();
+            REQUIRE_FALSE(Serialize(buffer, trade).has_value());
+            std::copy_n(buffer.data.begin(), buffer.used_bytes, slot);
+            frames.emplace_back(slot, buffer.used_bytes);
+            expected.emplace_back(trade);
+        }
+    }
+    // Corrupt a few frames spread across different slabs.
+    for (std::size_t i : {3UZ, 500UZ, 999UZ}) {
+        arena[i * FrameSize + StandardHeaderSize] ^= std::byte{0x40};
+    }
+
+    std::vector<ReplayDecoder::VariantType> serial_out(Count);
+    std::vector<std::optional<Error>> serial_errors(Count);
+    ReplayDecoder decoder;
+    const auto serial_failed =
+        decoder.DecodeBatch(frames, serial_out, serial_errors);
+    REQUIRE(serial_failed.value() == 3);
+
+    for (std::size_t threads : {0UZ, 1UZ, 3UZ, 8UZ, 2000UZ}) {
+        std::vector<ReplayDecoder::VariantType> out(Count);
+        std::vector<std::optional<Error>> errors(Count);
+        const auto failed =
+            DecodeBatchParallel<ReplayDecoder>(frames, out, errors, threads);
+        REQUIRE(failed.value() == 3);
+        REQUIRE(errors == serial_errors);
+        REQUIRE(out == serial_out);
+    }
+    REQUIRE(serial_errors[500]->code == ErrorCode::IntegrityCheckFailed);
+    REQUIRE(serial_out[998] == expected[998]);
+}
+
+TEST_CASE("DeserializeBatchParallel matches DeserializeBatch", "[parallel]") {
+    constexpr std::size_t Count = 257;
+    std::vector<std::byte> arena(Count * FrameSize);
+    std::vector<std::span<const std::byte>> quotes;
+    std::vector<Quote> expected(Count);
+    for (std::size_t i = 0; i < Count; ++i) {
+        std::byte* slot = arena.data() + i * FrameSize;
+        REQUIRE_FALSE(
+            expected[i].seq.set(static_cast<uint32_t>(i)).has_value());
+        REQUIRE_FALSE(
+            expected[i].bid.set(100.0 + static_cast<double>(i)).has_value());
+        auto buffer = GetBuffer<Quote, Integrity, Serdes>();
+        REQUIRE_FALSE(Serialize(buffer, expected[i]).has_value());
+        std::copy_n(buffer.data.begin(), buffer.used_bytes, slot);
+        quotes.emplace_back(slot, buffer.used_bytes);
+    }
+    // A Trade frame in a Quote batch fails on its message id.
+    Trade trade;
+    REQUIRE_FALSE(trade.seq.set(uint32_t{100}).has_value());
+    REQUIRE_FALSE(trade.qty.set(-100).has_value());
+    auto trade_buffer = GetBuffer<Trade, Integrity, Serdes>();
+    REQUIRE_FALSE(Serialize(trade_buffer, trade).has_value());
+    quotes[100] = trade_buffer.serialized_message_span();
+
+    for (std::size_t threads : {0UZ, 1UZ, 4UZ}) {
+        std::vector<Quote> out(Count);
+        std::vector<std::optional<Error>> errors(Count);
+        const auto failed = DeserializeBatchParallel<Quote, Integrity, Serdes>(
+            quotes, out, errors, threads);
+        REQUIRE(failed.value() == 1);
+        REQUIRE(errors[100]->code == ErrorCode::InvalidMessageId);
+        for (std::size_t i = 0; i < Count; ++i) {
+            if (i != 100) {
+                REQUIRE_FALSE(errors[i].has_value());
+                REQUIRE(out[i] == expected[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Parallel batch decode handles empty and undersized batches",
+          "[parallel]") {
+    std::vector<std::optional<Error>> errors;
+    std::vector<ReplayDecoder::VariantType> out;
+    REQUIRE(DecodeBatchParallel<ReplayDecoder>({}, out, errors).value() == 0);
+
+    Quote quote;
+    REQUIRE_FALSE(quote.seq.set(uint32_t{1}).has_value());
+    auto buffer = GetBuffer<Quote, Integrity, Serdes>();
+    REQUIRE_FALSE(Serialize(buffer, quote).has_value());
+    const std::vector<std::span<const std::byte>> frames(
+        4, buffer.serialized_message_span());
+    out.resize(4);
+    errors.resize(3);
+    const auto failed = DecodeBatchParallel<ReplayDecoder>(frames, out, errors);
+    REQUIRE_FALSE(failed.has_value());
+    REQUIRE(failed.error().code == ErrorCode::CapacityExceeded);
+}
@@ -0,0 +1,128 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+#include <span>
+
+using namespace Crunch;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct HopFrame {
+    CRUNCH_MESSAGE_FIELDS(ttl, label, hops, seq, payload);
+    static constexpr MessageId message_id = 0xE001;
+    Field<1, Required, UInt8<LessThan<128>>> ttl;
+    Field<2, Optional, String<9, None>> label;
+    Field<3, Optional, UInt16<None>> hops;
+    Field<4, Optional, Float64<None>> seq;
+    ArrayField<5, Int32<None>, 64, None> payload;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const HopFrame&) const = default;
+};
+
+static_assert(FieldWriterSerdesPolicy<serdes::PackedLayout, HopFrame, 1>);
+static_assert(!FieldWriterSerdesPolicy<serdes::PackedLayout, HopFrame, 2>);
+static_assert(!FieldWriterSerdesPolicy<serdes::TlvLayout, HopFrame, 1>);
+
+TEMPLATE_TEST_CASE("PatchField matches a full re-serialize", "[patch]",
+                   serdes::PackedLayout, serdes::Aligned32Layout,
+                   serdes::Aligned64Layout) {
+    HopFrame msg;
+    REQUIRE_FALSE(msg.ttl.set(uint8_t{64}).has_value());
+    REQUIRE_FALSE(msg.label.set("edge-7").has_value());
+    for (int32_t i = 0; i < 40; ++i) {
+        REQUIRE_FALSE(msg.payload.add(i * 7919).has_value());
+    }
+    auto buffer = GetBuffer<HopFrame, integrity::CRC16, TestType>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    REQUIRE_FALSE(PatchField<1>(buffer, uint8_t{63}).has_value());
+    REQUIRE_FALSE(PatchField<3>(buffer, uint16_t{1}).has_value());
+    REQUIRE_FALSE(PatchField<4>(buffer, 12345.5).has_value());
+
+    REQUIRE_FALSE(msg.ttl.set(uint8_t{63}).has_value());
+    REQUIRE_FALSE(msg.hops.set(uint16_t{1}).has_value());
+    REQUIRE_FALSE(msg.seq.set(12345.5).has_value());
+    auto expected = GetBuffer<HopFrame, integrity::CRC16, TestType>();
+    REQUIRE_FALSE(Serialize(expected, msg).has_value());
+    REQUIRE(buffer.data == expected.data);
+
+    HopFrame out;
+    REQUIRE_FALSE(Deserialize(buffer, out).has_value());
+    REQUIRE(out == msg);
+}
+
+TEMPLATE_TEST_CASE("PatchField updates every patchable checksum", "[patch]",
+                   integrity::None, integrity::Parity, integrity::CRC32C,
+                   integrity::CRC64) {
+    HopFrame msg;
+    REQUIRE_FALSE(msg.ttl.set(uint8_t{64}).has_value());
+    REQUIRE_FALSE(msg.payload.add(int32_t{7919}).has_value());
+    auto buffer = GetBuffer<HopFrame, TestType, serdes::Aligned64Layout>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    REQUIRE_FALSE(PatchField<1>(buffer, uint8_t{63}).has_value());
+    REQUIRE_FALSE(msg.ttl.set(uint8_t{63}).has_value());
+    auto expected = GetBuffer<HopFrame, TestType, serdes::Aligned64Layout>();
+    REQUIRE_FALSE(Serialize(expected, msg).has_value());
+    REQUIRE(buffer.data == expected.data);
+}
+
+TEST_CASE("PatchField on a forwarded frame", "[patch]") {
+    using Integrity = integrity::CRC16;
+    using Serdes = serdes::Aligned32Layout;
+    HopFrame msg;
+    REQUIRE_FALSE(msg.ttl.set(uint8_t{64}).has_value());
+    REQUIRE_FALSE(msg.label.set("edge-7").has_value());
+    for (int32_t i = 0; i < 40; ++i) {
+        REQUIRE_FALSE(msg.payload.add(i * 7919).has_value());
+    }
+    auto buffer = GetBuffer<HopFrame, Integrity, Serdes>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+    std::array<std::byte, buffer.Size> frame = buffer.data;
+
+    SECTION("Decrements the TTL") {
+        REQUIRE_FALSE(PatchField<HopFrame, Integrity, Serdes, 1>(
+                          std::span{frame}, uint8_t{63})
+                          .has_value());
+        auto received = GetBuffer<HopFrame, Integrity, Serdes>();
+        received.data = frame;
+        received.used_bytes = frame.size();
+        HopFrame out;
+        REQUIRE_FALSE(Deserialize(received, out).has_value());
+        REQUIRE(out.ttl.get() == uint8_t{63});
+        REQUIRE(out.label.get() == "edge-7");
+    }
+
+    SECTION("Rejects invalid values without writing") {
+        const auto err = PatchField<HopFrame, Integrity, Serdes, 1>(
+            std::span{frame}, uint8_t{200});
+        REQUIRE(err.has_value());
+        REQUIRE(err->code == ErrorCode::ValidationFailed);
+        REQUIRE(frame == buffer.data);
+    }
+
+    SECTION("Rejects a frame of another message") {
+        frame[2] = std::byte{0x02};
+        const auto err = PatchField<HopFrame, Integrity, Serdes, 1>(
+            std::span{frame}, uint8_t{63});
+        REQUIRE(err.has_value());
+        REQUIRE(err->code == ErrorCode::InvalidMessageId);
+    }
+
+    SECTION("Keeps corruption detectable") {
+        frame[frame.size() - 10] ^= std::byte{0x01};
+        REQUIRE_FALSE(PatchField<HopFrame, Integrity, Serdes, 1>(
+                          std::span{frame}, uint8_t{63})
+                          .has_value());
+        auto received = GetBuffer<HopFrame, Integrity, Serdes>();
+        received.data = frame;
+        received.used_bytes = frame.size();
+        HopFrame out;
+        REQUIRE(Deserialize(received, out) == Error::integrity());
+    }
+}
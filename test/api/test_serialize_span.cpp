@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+#include <span>
+#include <vector>
+
+using namespace Crunch;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct Order {
+    CRUNCH_MESSAGE_FIELDS(id, qty, symbol, legs);
+    static constexpr MessageId message_id = 0xD001;
+    Field<1, Required, UInt32<None>> id;
+    Field<2, Required, Int32<LessThan<10000>>> qty;
+    Field<3, Optional, String<12, None>> symbol;
+    ArrayField<4, UInt16<None>, 4, None> legs;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const Order&) const = default;
+};
+
+TEMPLATE_TEST_CASE("Serialize into a span matches Serialize into a Buffer",
+                   "[serialize][span]", serdes::PackedLayout,
+                   serdes::Aligned64Layout, serdes::TlvLayout) {
+    using Integrity = integrity::CRC32C;
+    using Serdes = TestType;
+    using BufferType = decltype(GetBuffer<Order, Integrity, Serdes>());
+    constexpr std::size_t SlotSize = BufferType::Size;
+
+    // A ring of fixed-size slots with guard bytes on either side.
+    constexpr std::size_t Slots = 4;
+    std::array<std::byte, Slots * SlotSize + 2> ring{};
+    ring.fill(std::byte{0xEE});
+
+    for (uint32_t i = 0; i < Slots; ++i) {
+        Order order;
+        REQUIRE_FALSE(order.id.set(i + 1).has_value());
+        REQUIRE_FALSE(order.qty.set(static_cast<int32_t>(i * 10)).has_value());
+        REQUIRE_FALSE(order.symbol.set("ACME").has_value());
+        REQUIRE_FALSE(order.legs.add(uint16_t{7}).has_value());
+        auto buffer = GetBuffer<Order, Integrity, Serdes>();
+        REQUIRE_FALSE(Serialize(buffer, order).has_value());
+
+        const std::span<std::byte> slot{ring.data() + 1 + i * SlotSize,
+                                        SlotSize};
+        const auto written = Serialize<Order, Integrity, Serdes>(slot, order);
+        REQUIRE(written.value() == buffer.used_bytes);
+        const auto expected = buffer.serialized_message_span();
+        REQUIRE(std::equal(expected.begin(), expected.end(), slot.begin()));
+
+        Order decoded;
+        REQUIRE_FALSE(detail::Deserialize<Integrity, Serdes>(
+                          slot.first(*written), decoded)
+                          .has_value());
+        REQUIRE(decoded == order);
+    }
+    REQUIRE(ring.front() == std::byte{0xEE});
+    REQUIRE(ring.back() == std::byte{0xEE});
+}
+
+TEST_CASE("Serialize into a span rejects a span smaller than the frame size",
+          "[serialize][span]") {
+    using Integrity = integrity::CRC32C;
+    using Serdes = serdes::PackedLayout;
+    constexpr std::size_t FrameSize =
+        decltype(GetBuffer<Order, Integrity, Serdes>())::Size;
+    std::array<std::byte, FrameSize - 1> small{};
+    Order order;
+    REQUIRE_FALSE(order.id.set(uint32_t{1}).has_value());
+    REQUIRE_FALSE(order.qty.set(int32_t{1}).has_value());
+
+    const auto result = Serialize<Order, Integrity, Serdes>(small, order);
+    REQUIRE_FALSE(result.has_value());
+    REQUIRE(result.error().code == ErrorCode::CapacityExceeded);
+    REQUIRE(std::ranges::all_of(
+        small, [](std::byte b) { return b == std::byte{0}; }));
+
+    const auto unchecked =
+        SerializeWithoutValidation<Order, Integrity, Serdes>(small, order);
+    REQUIRE_FALSE(unchecked.has_value());
+    REQUIRE(unchecked.error().code == ErrorCode::CapacityExceeded);
+}
+
+TEST_CASE("Serialize into a span validates unless asked not to",
+          "[serialize][span]") {
+    using Integrity = integrity::CRC16;
+    using Serdes = serdes::TlvLayout;
+    std::array<std::byte,
+               decltype(GetBuffer<Order, Integrity, Serdes>())::Size>
+        out{};
+    Order order;
+    REQUIRE_FALSE(order.id.set(uint32_t{3}).has_value());
+    REQUIRE_FALSE(order.symbol.set("ACME").has_value());
+    order.qty.set_without_validation(20000);
+
+    const auto result = Serialize<Order, Integrity, Serdes>(out, order);
+    REQUIRE_FALSE(result.has_value());
+    REQUIRE(result.error().code == ErrorCode::ValidationFailed);
+
+    const auto written =
+        SerializeWithoutValidation<Order, Integrity, Serdes>(out, order);
+    REQUIRE(written.has_value());
+    auto buffer = GetBuffer<Order, Integrity, Serdes>();
+    SerializeWithoutValidation(buffer, order);
+    REQUIRE(*written == buffer.used_bytes);
+    REQUIRE(std::equal(out.begin(), out.begin() + *written,
+                       buffer.data.begin()));
+}
+
+TEST_CASE("Serialize into a span fits TLV frames into tight slots",
+          "[serialize][span]") {
+    using Integrity = integrity::CRC32C;
+    using Serdes = serdes::TlvLayout;
+    constexpr std::size_t MaxFrame =
+        decltype(GetBuffer<Order, Integrity, Serdes>())::Size;
+
+    // Pack frames densely, each slot sized by SerializedSize.
+    std::array<std::byte, MaxFrame * 3> arena{};
+    std::size_t offset = 0;
+    std::vector<std::span<const std::byte>> frames;
+    for (uint32_t i = 1; i <= 3; ++i) {
+        Order order;
+        REQUIRE_FALSE(order.id.set(i * 1000).has_value());
+        REQUIRE_FALSE(order.qty.set(static_cast<int32_t>(i)).has_value());
+        if (i != 2) {
+            REQUIRE_FALSE(order.symbol.set("ACME").has_value());
+            REQUIRE_FALSE(order.legs.add(uint16_t{7}).has_value());
+        }
+        const std::size_t size =
+            SerializedSize<Order, Integrity, Serdes>(order);
+        REQUIRE(size < MaxFrame);
+
+        const std::span<std::byte> slot{arena.data() + offset, size};
+        REQUIRE(Serialize<Order, Integrity, Serdes>(slot, order).value() ==
+                size);
+        REQUIRE_FALSE(Serialize<Order, Integrity, Serdes>(
+                          slot.first(size - 1), order)
+                          .has_value());
+        frames.emplace_back(slot);
+        offset += size;
+    }
+
+    for (uint32_t i = 1; i <= 3; ++i) {
+        Order decoded;
+        REQUIRE_FALSE(
+            detail::Deserialize<Integrity, Serdes>(frames[i - 1], decoded)
+                .has_value());
+        REQUIRE(*decoded.id.get() == i * 1000);
+    }
+}
@@ -0,0 +1,336 @@
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <crunch/crunch.hpp>
+#include <crunch/crunch_frame_assembler.hpp>
+#include <crunch/crunch_vectored_writer.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+#include <cstdio>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <variant>
+#include <vector>
+
+using namespace Crunch;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct Tick {
+    CRUNCH_MESSAGE_FIELDS(seq, symbol);
+    static constexpr MessageId message_id = 0xB001;
+    Field<1, Required, UInt32<None>> seq;
+    Field<2, Optional, String<24, None>> symbol;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const Tick&) const = default;
+};
+
+using TickBuffer =
+    decltype(GetBuffer<Tick, integrity::CRC32C, serdes::TlvLayout>());
+using TickDecoder = Decoder<serdes::TlvLayout, integrity::CRC32C, Tick>;
+
+namespace {
+constexpr VectoredWriterConfig NoAutoFlush{
+    .max_bytes = std::size_t{1} << 30,
+    .max_latency = std::chrono::hours{1},
+};
+
+std::vector<std::byte> Concat(const std::vector<TickBuffer>& buffers) {
+    std::vector<std::byte> bytes;
+    for (const auto& buffer : buffers) {
+        const auto frame = buffer.serialized_message_span();
+        bytes.insert(bytes.end(), frame.begin(), frame.end());
+    }
+    return bytes;
+}
+
+std::vector<std::byte> ReadAvailable(int fd, std::size_t count) {
+    std::vector<std::byte> bytes(count);
+    std::size_t got = 0;
+    while (got < count) {
+        const ssize_t n = ::read(fd, bytes.data() + got, count - got);
+        REQUIRE(n > 0);
+        got += static_cast<std::size_t>(n);
+    }
+    return bytes;
+}
+
+struct SocketPair {
+    SocketPair() { REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0); }
+    ~SocketPair() {
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+    int fds[2];
+};
+}  // namespace
+
+TEST_CASE("VectoredWriter flushes once a batch is full",
+          "[VectoredWriter]") {
+    std::vector<TickBuffer> buffers(8);
+    for (uint32_t i = 0; i < buffers.size(); ++i) {
+        Tick tick;
+        REQUIRE_FALSE(tick.seq.set(i).has_value());
+        REQUIRE_FALSE(tick.symbol.set("CRUNCH.EXAMPLE").has_value());
+        REQUIRE_FALSE(Serialize(buffers[i], tick).has_value());
+    }
+    const auto expected = Concat(buffers);
+    SocketPair sockets;
+    VectoredWriter<4> writer(sockets.fds[0], NoAutoFlush);
+
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < buffers.size(); ++i) {
+        const auto result = writer.Add(buffers[i]);
+        REQUIRE(result.has_value());
+        REQUIRE((*result == 0) == (i % 4 != 3));
+        written += *result;
+    }
+    REQUIRE(writer.pending() == 0);
+    REQUIRE(written == expected.size());
+    REQUIRE(ReadAvailable(sockets.fds[1], expected.size()) == expected);
+}
+
+TEST_CASE("VectoredWriter flushes at the byte and latency bounds",
+          "[VectoredWriter]") {
+    std::vector<TickBuffer> buffers(4);
+    for (uint32_t i = 0; i < buffers.size(); ++i) {
+        Tick tick;
+        REQUIRE_FALSE(tick.seq.set(i).has_value());
+        REQUIRE_FALSE(tick.symbol.set("CRUNCH.EXAMPLE").has_value());
+        REQUIRE_FALSE(Serialize(buffers[i], tick).has_value());
+    }
+    const std::size_t frame_size =
+        buffers[0].serialized_message_span().size();
+    SocketPair sockets;
+
+    SECTION("max_bytes") {
+        VectoredWriter<64> writer(
+            sockets.fds[0], {.max_bytes = 2 * frame_size,
+                             .max_latency = std::chrono::hours{1}});
+        REQUIRE(*writer.Add(buffers[0]) == 0);
+        REQUIRE(writer.pending_bytes() == frame_size);
+        REQUIRE(*writer.Add(buffers[1]) == 2 * frame_size);
+        REQUIRE(writer.pending_bytes() == 0);
+    }
+
+    SECTION("zero latency writes every frame") {
+        VectoredWriter<64> writer(sockets.fds[0],
+                                  {.max_latency = std::chrono::seconds{0}});
+        for (const auto& buffer : buffers) {
+            REQUIRE(*writer.Add(buffer) == frame_size);
+        }
+    }
+
+    SECTION("Poll flushes overdue frames") {
+        VectoredWriter<64> writer(
+            sockets.fds[0], {.max_latency = std::chrono::milliseconds{1}});
+        REQUIRE(*writer.Poll() == 0);
+        REQUIRE(*writer.Add(buffers[0]) == 0);
+        std::this_thread::sleep_until(writer.Deadline());
+        REQUIRE(*writer.Poll() == frame_size);
+        REQUIRE(writer.pending() == 0);
+    }
+}
+
+TEST_CASE("VectoredWriter output decodes from a pipe and a file",
+          "[VectoredWriter]") {
+    std::vector<TickBuffer> buffers(20);
+    for (uint32_t i = 0; i < buffers.size(); ++i) {
+        Tick tick;
+        REQUIRE_FALSE(tick.seq.set(i).has_value());
+        REQUIRE_FALSE(tick.symbol.set("CRUNCH.EXAMPLE").has_value());
+        REQUIRE_FALSE(Serialize(buffers[i], tick).has_value());
+    }
+    const auto expected = Concat(buffers);
+
+    int fd = -1;
+    int read_fd = -1;
+    std::FILE* file = nullptr;
+    int pipe_fds[2] = {-1, -1};
+    SECTION("pipe") {
+        REQUIRE(::pipe(pipe_fds) == 0);
+        fd = pipe_fds[1];
+        read_fd = pipe_fds[0];
+    }
+    SECTION("file") {
+        file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        fd = ::fileno(file);
+        read_fd = fd;
+    }
+
+    VectoredWriter<8> writer(fd, NoAutoFlush);
+    for (const auto& buffer : buffers) {
+        REQUIRE(writer.Add(buffer).has_value());
+    }
+    REQUIRE(*writer.Flush() > 0);
+    if (file != nullptr) {
+        REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+    }
+    const auto bytes = ReadAvailable(read_fd, expected.size());
+    REQUIRE(bytes == expected);
+
+    FrameAssembler<TickDecoder> assembler;
+    const TickDecoder decoder;
+    std::span<const std::byte> unfed{bytes};
+    uint32_t decoded = 0;
+    while (decoded < buffers.size()) {
+        unfed = unfed.subspan(assembler.Feed(unfed));
+        for (auto frame = assembler.NextFrame(); !frame->empty();
+             frame = assembler.NextFrame()) {
+            TickDecoder::VariantType out;
+            REQUIRE_FALSE(decoder.Decode(*frame, out).has_value());
+            REQUIRE(std::get<Tick>(out).seq.get() == decoded++);
+        }
+    }
+
+    if (file != nullptr) {
+        std::fclose(file);
+    } else {
+        ::close(pipe_fds[0]);
+        ::close(pipe_fds[1]);
+    }
+}
+
+TEST_CASE("VectoredWriter resumes after a full non-blocking socket",
+          "[VectoredWriter]") {
+    std::vector<TickBuffer> buffers(200);
+    for (uint32_t i = 0; i < buffers.size(); ++i) {
+        Tick tick;
+        REQUIRE_FALSE(tick.seq.set(i).has_value());
+        REQUIRE_FALSE(tick.symbol.set("CRUNCH.EXAMPLE").has_value());
+        REQUIRE_FALSE(Serialize(buffers[i], tick).has_value());
+    }
+    const auto expected = Concat(buffers);
+    SocketPair sockets;
+    const int sndbuf = 1024;
+    REQUIRE(::setsockopt(sockets.fds[0], SOL_SOCKET, SO_SNDBUF, &sndbuf,
+                         sizeof(sndbuf)) == 0);
+    REQUIRE(::fcntl(sockets.fds[0], F_SETFL, O_NONBLOCK) == 0);
+
+    VectoredWriter<256> writer(sockets.fds[0], NoAutoFlush);
+    for (const auto& buffer : buffers) {
+        REQUIRE(*writer.Add(buffer) == 0);
+    }
+
+    std::vector<std::byte> received;
+    bool blocked = false;
+    while (writer.pending() > 0) {
+        const auto result = writer.Flush();
+        REQUIRE(result.has_value());
+        if (writer.pending() > 0) {
+            // The partial count came back; nothing was read, so the next
+            // flush reports the full socket.
+            REQUIRE(writer.Flush().error() ==
+                    std::errc::resource_unavailable_try_again);
+            blocked = true;
+        }
+        const std::size_t unread =
+            expected.size() - received.size() - writer.pending_bytes();
+        const auto chunk = ReadAvailable(sockets.fds[1], unread);
+        received.insert(received.end(), chunk.begin(), chunk.end());
+    }
+    REQUIRE(blocked);
+    REQUIRE(received == expected);
+}
+
+TEST_CASE("VectoredWriter refuses frames while a failed batch is full",
+          "[VectoredWriter]") {
+    std::vector<TickBuffer> buffers(3);
+    for (uint32_t i = 0; i < buffers.size(); ++i) {
+        Tick tick;
+        REQUIRE_FALSE(tick.seq.set(i).has_value());
+        REQUIRE_FALSE(tick.symbol.set("CRUNCH.EXAMPLE").has_value());
+        REQUIRE_FALSE(Serialize(buffers[i], tick).has_value());
+    }
+    int pipe_fds[2];
+    REQUIRE(::pipe(pipe_fds) == 0);
+
+    // Writing to the read end of a pipe fails with EBADF.
+    VectoredWriter<2> writer(pipe_fds[0], NoAutoFlush);
+    REQUIRE(*writer.Add(buffers[0]) == 0);
+    // The second frame fills the batch, and the flush fails.
+    REQUIRE(writer.Add(buffers[1]).error() ==
+            std::errc::bad_file_descriptor);
+    REQUIRE(writer.pending() == 2);
+    REQUIRE(writer.Add(buffers[2]).error() == std::errc::no_buffer_space);
+    REQUIRE(writer.pending() == 2);
+
+    ::close(pipe_fds[0]);
+    ::close(pipe_fds[1]);
+}
+
+TEST_CASE("VectoredWriter returns EPIPE once a socket's peer has closed",
+          "[VectoredWriter]") {
+    std::vector<TickBuffer> buffers(2);
+    for (uint32_t i = 0; i < buffers.size(); ++i) {
+        Tick tick;
+        REQUIRE_FALSE(tick.seq.set(i).has_value());
+        REQUIRE_FALSE(tick.symbol.set("CRUNCH.EXAMPLE").has_value());
+        REQUIRE_FALSE(Serialize(buffers[i], tick).has_value());
+    }
+    SocketPair sockets;
+    ::close(sockets.fds[1]);
+    sockets.fds[1] = -1;
+
+    // Without MSG_NOSIGNAL this would raise SIGPIPE and end the test run.
+    VectoredWriter<4> writer(sockets.fds[0], NoAutoFlush);
+    REQUIRE(*writer.Add(buffers[0]) == 0);
+    REQUIRE(*writer.Add(buffers[1]) == 0);
+    REQUIRE(writer.Flush().error() == std::errc::broken_pipe);
+    REQUIRE(writer.pending() == 2);
+}
+
+TEST_CASE("VectoredWriter returns the partial count before a later EPIPE",
+          "[VectoredWriter]") {
+    std::vector<TickBuffer> buffers(1000);
+    for (uint32_t i = 0; i < buffers.size(); ++i) {
+        Tick tick;
+        REQUIRE_FALSE(tick.seq.set(i).has_value());
+        REQUIRE_FALSE(tick.symbol.set("CRUNCH.EXAMPLE").has_value());
+        REQUIRE_FALSE(Serialize(buffers[i], tick).has_value());
+    }
+    const std::size_t total = Concat(buffers).size();
+    SocketPair sockets;
+    const int sndbuf = 1024;
+    REQUIRE(::setsockopt(sockets.fds[0], SOL_SOCKET, SO_SNDBUF, &sndbuf,
+                         sizeof(sndbuf)) == 0);
+
+    VectoredWriter<1024> writer(sockets.fds[0], NoAutoFlush);
+    for (const auto& buffer : buffers) {
+        REQUIRE(*writer.Add(buffer) == 0);
+    }
+
+    // The peer takes the first 4 KiB and then hangs up, so the blocking
+    // writer fails partway through the batch.
+    std::thread peer([fd = sockets.fds[1]] {
+        std::vector<std::byte> bytes(4096);
+        std::size_t got = 0;
+        while (got < bytes.size()) {
+            const ssize_t n =
+                ::read(fd, bytes.data() + got, bytes.size() - got);
+            if (n <= 0) {
+                break;
+            }
+            got += static_cast<std::size_t>(n);
+        }
+        ::close(fd);
+    });
+    const auto result = writer.Flush();
+    peer.join();
+    sockets.fds[1] = -1;
+
+    REQUIRE(result.has_value());
+    REQUIRE(*result >= 4096);
+    REQUIRE(*result < total);
+    REQUIRE(*result + writer.pending_bytes() == total);
+    REQUIRE(writer.Flush().error() == std::errc::broken_pipe);
+    REQUIRE(*result + writer.pending_bytes() == total);
+}
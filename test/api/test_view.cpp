@@ -0,0 +1,175 @@
+#include <array>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <crunch/serdes/crunch_tlv_layout.hpp>
+#include <string_view>
+
+using namespace Crunch;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct ViewInner {
+    CRUNCH_MESSAGE_FIELDS(flag, price);
+    static constexpr MessageId message_id = 0xB001;
+    Field<1, Optional, Bool<None>> flag;
+    Field<2, Optional, Float64<None>> price;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const ViewInner&) const = default;
+};
+
+struct ViewMessage {
+    CRUNCH_MESSAGE_FIELDS(id, name, inner, samples, labels, legs, unset);
+    static constexpr MessageId message_id = 0xB002;
+    Field<1, Required, Int16<None>> id;
+    Field<2, Optional, String<13, None>> name;
+    Field<3, Optional, ViewInner> inner;
+    ArrayField<4, Float64<None>, 9, None> samples;
+    MapField<5, Int8<None>, String<5, None>, 4, None> labels;
+    ArrayField<6, ViewInner, 3, None> legs;
+    Field<7, Optional, UInt32<None>> unset;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const ViewMessage&) const = default;
+};
+
+// String<5> elements have an odd size, so under Aligned64 the padding before
+// each element alternates and element offsets follow a repeating cycle.
+struct ViewNames {
+    CRUNCH_MESSAGE_FIELDS(tag, names);
+    static constexpr MessageId message_id = 0xB003;
+    Field<1, Optional, Int8<None>> tag;
+    ArrayField<2, String<5, None>, 12, None> names;
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const ViewNames&) const = default;
+};
+
+TEMPLATE_TEST_CASE("View reads every field in place", "[view]",
+                   serdes::PackedLayout, serdes::Aligned32Layout,
+                   serdes::Aligned64Layout) {
+    ViewMessage msg;
+    REQUIRE_FALSE(msg.id.set(int16_t{-321}).has_value());
+    REQUIRE_FALSE(msg.name.set("zero copy").has_value());
+    ViewInner inner_msg;
+    REQUIRE_FALSE(inner_msg.flag.set(true).has_value());
+    REQUIRE_FALSE(inner_msg.price.set(99.5).has_value());
+    msg.inner.set(inner_msg);
+    for (int i = 0; i < 7; ++i) {
+        REQUIRE_FALSE(msg.samples.add(i * -0.375).has_value());
+    }
+    REQUIRE_FALSE(msg.labels.insert(int8_t{3}, "bid").has_value());
+    REQUIRE_FALSE(msg.labels.insert(int8_t{-4}, "ask").has_value());
+    ViewInner leg;
+    REQUIRE_FALSE(leg.flag.set(false).has_value());
+    REQUIRE_FALSE(leg.price.set(1.25).has_value());
+    REQUIRE_FALSE(msg.legs.add(leg).has_value());
+    REQUIRE_FALSE(leg.flag.set(true).has_value());
+    REQUIRE_FALSE(leg.price.set(-8.0).has_value());
+    REQUIRE_FALSE(msg.legs.add(leg).has_value());
+    auto buffer = GetBuffer<ViewMessage, integrity::CRC16, TestType>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    const auto view = GetView(buffer);
+    REQUIRE(view.has_value());
+
+    REQUIRE(view->template get<1>() == std::optional<int16_t>{-321});
+    REQUIRE(view->template get<2>() ==
+            std::optional<std::string_view>{"zero copy"});
+    REQUIRE_FALSE(view->template get<7>().has_value());
+
+    const auto inner = view->template get<3>();
+    REQUIRE(inner.has_value());
+    REQUIRE(inner->template get<1>() == std::optional<bool>{true});
+    REQUIRE(inner->template get<2>() == std::optional<double>{99.5});
+
+    const auto samples = view->template get<4>();
+    REQUIRE(samples.size() == msg.samples.size());
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        REQUIRE(samples[i] == msg.samples[i].get());
+    }
+
+    const auto labels = view->template get<5>();
+    REQUIRE(labels.size() == 2);
+    REQUIRE(labels.key(1) == -4);
+    REQUIRE(labels.value(1) == "ask");
+    REQUIRE(labels.at(int8_t{3}) == std::optional<std::string_view>{"bid"});
+    REQUIRE_FALSE(labels.at(int8_t{5}).has_value());
+
+    const auto legs = view->template get<6>();
+    REQUIRE(legs.size() == 2);
+    REQUIRE(legs[0].template get<1>() == std::optional<bool>{false});
+    REQUIRE(legs[1].template get<2>() == std::optional<double>{-8.0});
+}
+
+TEST_CASE("View element offsets match sequential decoding", "[view]") {
+    ViewNames msg;
+    REQUIRE_FALSE(msg.tag.set(int8_t{1}).has_value());
+    constexpr std::array<std::string_view, 12> Expected = {
+        "a", "bb", "ccc", "dddd", "eeeee", "f",
+        "gg", "hhh", "iiii", "jjjjj", "k", "ll"};
+    for (const auto name : Expected) {
+        String<5, None> element;
+        REQUIRE_FALSE(element.set(name).has_value());
+        REQUIRE_FALSE(msg.names.add(element).has_value());
+    }
+
+    auto buffer =
+        GetBuffer<ViewNames, integrity::None, serdes::Aligned64Layout>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+    const auto view = GetView(buffer);
+    REQUIRE(view.has_value());
+    const auto names = view->get<2>();
+    REQUIRE(names.size() == Expected.size());
+    for (std::size_t i = 0; i < Expected.size(); ++i) {
+        CAPTURE(i);
+        REQUIRE(names[i] == Expected[i]);
+    }
+}
+
+TEST_CASE("View rejects invalid buffers", "[view]") {
+    ViewMessage msg;
+    REQUIRE_FALSE(msg.id.set(int16_t{-321}).has_value());
+    REQUIRE_FALSE(msg.name.set("zero copy").has_value());
+    auto buffer =
+        GetBuffer<ViewMessage, integrity::CRC16, serdes::PackedLayout>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    SECTION("Corrupted payload") {
+        auto corrupted = buffer;
+        corrupted.data[20] ^= std::byte{0x01};
+        const auto view = GetView(corrupted);
+        REQUIRE_FALSE(view.has_value());
+        REQUIRE(view.error() == Error::integrity());
+    }
+
+    SECTION("Wrong message type") {
+        const auto view =
+            GetView<ViewInner, integrity::CRC16, serdes::PackedLayout>(
+                buffer.serialized_message_span());
+        REQUIRE_FALSE(view.has_value());
+        REQUIRE(view.error() == Error::invalid_message_id());
+    }
+
+    SECTION("Length prefix past capacity") {
+        auto unchecked =
+            GetBuffer<ViewMessage, integrity::None, serdes::PackedLayout>();
+        REQUIRE_FALSE(Serialize(unchecked, msg).has_value());
+        // id: presence @6, value @7; name: presence @9, length @10.
+        unchecked.data[10] = std::byte{14};
+        const auto view = GetView(unchecked);
+        REQUIRE_FALSE(view.has_value());
+        REQUIRE(view.error().code == ErrorCode::CapacityExceeded);
+    }
+}
+
+TEST_CASE("View is only available for in-place layouts", "[view]") {
+    STATIC_REQUIRE(InPlaceSerdesPolicy<serdes::PackedLayout, ViewMessage>);
+    STATIC_REQUIRE_FALSE(InPlaceSerdesPolicy<serdes::TlvLayout, ViewMessage>);
+}
@@ -0,0 +1,388 @@
+#include <algorithm>
+#include <array>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
+#include <crunch/fields/crunch_scalar.hpp>
+#include <crunch/fields/crunch_string.hpp>
+#include <crunch/messages/crunch_messages.hpp>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+using namespace Crunch;
+using namespace Crunch::serdes;
+using namespace Crunch::messages;
+using namespace Crunch::fields;
+
+struct FlatMessage {
+    static constexpr MessageId message_id = 0x5107;
+    Field<1, Optional, Int8<None>> a;
+    Field<2, Optional, Float64<None>> b;
+    Field<3, Optional, Int16<None>> c;
+    Field<4, Optional, Bool<None>> d;
+    Field<5, Optional, UInt32<None>> e;
+    CRUNCH_MESSAGE_FIELDS(a, b, c, d, e);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const FlatMessage&) const = default;
+};
+
+struct FlatOuter {
+    static constexpr MessageId message_id = 0x5108;
+    Field<1, Optional, FlatMessage> inner;
+    Field<2, Optional, Int32<None>> tail;
+    CRUNCH_MESSAGE_FIELDS(inner, tail);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const FlatOuter&) const = default;
+};
+
+struct MixedOuter {
+    static constexpr MessageId message_id = 0x5109;
+    Field<1, Optional, FlatMessage> inner;
+    Field<2, Optional, String<8, None>> name;
+    CRUNCH_MESSAGE_FIELDS(inner, name);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const MixedOuter&) const = default;
+};
+
+namespace {
+template <typename T>
+void WriteLe(std::span<std::byte> out, std::size_t offset, T value) {
+    const T le_value = Crunch::LittleEndian(value);
+    std::memcpy(out.data() + offset, &le_value, sizeof(T));
+}
+}  // namespace
+
+TEST_CASE("StaticLayout: flat message bytes match the field-by-field layout",
+          "[static]") {
+    using Layout = Aligned64Layout;
+    constexpr std::size_t Start = 8;  // Header padded to 8 bytes
+
+    // Presence/value offsets relative to the payload start:
+    // a @0/1, b @2/8, c @16/18 (unset), d @20/21, e @22/24, end 28.
+    REQUIRE(Layout::Size<FlatMessage>() == Start + 28);
+
+    std::array<std::byte, Start + 28> expected{};
+    const std::span out{expected};
+    out[Start + 0] = std::byte{1};
+    WriteLe(out, Start + 1, int8_t{0x11});
+    out[Start + 2] = std::byte{1};
+    WriteLe(out, Start + 8, -2.5);
+    out[Start + 20] = std::byte{1};
+    out[Start + 21] = std::byte{1};
+    out[Start + 22] = std::byte{1};
+    WriteLe(out, Start + 24, 0xA1B2C3D4U);
+
+    FlatMessage msg;
+    REQUIRE_FALSE(msg.a.set(int8_t{0x11}).has_value());
+    REQUIRE_FALSE(msg.b.set(-2.5).has_value());
+    REQUIRE_FALSE(msg.d.set(true).has_value());
+    REQUIRE_FALSE(msg.e.set(0xA1B2C3D4U).has_value());
+    std::array<std::byte, Start + 28> actual;
+    actual.fill(std::byte{0xEE});
+    const std::size_t size = Layout::Serialize(msg, actual);
+    REQUIRE(size == actual.size());
+    REQUIRE(std::ranges::equal(std::span{actual}.subspan(Start),
+                               std::span{expected}.subspan(Start)));
+}
+
+TEST_CASE("StaticLayout: nested flat message bytes", "[static]") {
+    using Layout = Aligned64Layout;
+    constexpr std::size_t Start = 8;
+
+    // inner presence @0, pad to 8, id @8, fields from 12:
+    // a @12/13, b @14/16, c @24/26, d @28/29, e @30/32, tail @36/40, end 44.
+    REQUIRE(Layout::Size<FlatOuter>() == Start + 44);
+
+    std::array<std::byte, Start + 44> expected{};
+    const std::span out{expected};
+    out[Start + 0] = std::byte{1};
+    WriteLe(out, Start + 8, FlatMessage::message_id);
+    out[Start + 12] = std::byte{1};
+    WriteLe(out, Start + 13, int8_t{0x11});
+    out[Start + 14] = std::byte{1};
+    WriteLe(out, Start + 16, -2.5);
+    out[Start + 28] = std::byte{1};
+    out[Start + 29] = std::byte{1};
+    out[Start + 30] = std::byte{1};
+    WriteLe(out, Start + 32, 0xA1B2C3D4U);
+    out[Start + 36] = std::byte{1};
+    WriteLe(out, Start + 40, int32_t{-9});
+
+    FlatMessage inner;
+    REQUIRE_FALSE(inner.a.set(int8_t{0x11}).has_value());
+    REQUIRE_FALSE(inner.b.set(-2.5).has_value());
+    REQUIRE_FALSE(inner.d.set(true).has_value());
+    REQUIRE_FALSE(inner.e.set(0xA1B2C3D4U).has_value());
+    FlatOuter msg;
+    msg.inner.set(inner);
+    REQUIRE_FALSE(msg.tail.set(-9).has_value());
+
+    std::array<std::byte, Start + 44> actual;
+    actual.fill(std::byte{0xEE});
+    REQUIRE(Layout::Serialize(msg, actual) == actual.size());
+    REQUIRE(std::ranges::equal(std::span{actual}.subspan(Start),
+                               std::span{expected}.subspan(Start)));
+}
+
+TEMPLATE_TEST_CASE("StaticLayout: flat messages round trip", "[static]",
+                   PackedLayout, Aligned32Layout, Aligned64Layout) {
+    SECTION("Top level") {
+        FlatMessage msg;
+        REQUIRE_FALSE(msg.a.set(int8_t{0x11}).has_value());
+        REQUIRE_FALSE(msg.b.set(-2.5).has_value());
+        REQUIRE_FALSE(msg.d.set(true).has_value());
+        REQUIRE_FALSE(msg.e.set(0xA1B2C3D4U).has_value());
+        auto buffer = GetBuffer<FlatMessage, integrity::CRC16, TestType>();
+        REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+        FlatMessage out;
+        REQUIRE_FALSE(Deserialize(buffer, out).has_value());
+        REQUIRE(out == msg);
+    }
+
+    SECTION("Nested next to non-scalar fields") {
+        FlatMessage inner;
+        REQUIRE_FALSE(inner.a.set(int8_t{0x11}).has_value());
+        REQUIRE_FALSE(inner.b.set(-2.5).has_value());
+        REQUIRE_FALSE(inner.d.set(true).has_value());
+        REQUIRE_FALSE(inner.e.set(0xA1B2C3D4U).has_value());
+        MixedOuter msg;
+        msg.inner.set(inner);
+        REQUIRE_FALSE(msg.name.set("flat").has_value());
+        auto buffer = GetBuffer<MixedOuter, integrity::CRC16, TestType>();
+        REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+        MixedOuter out;
+        REQUIRE_FALSE(Deserialize(buffer, out).has_value());
+        REQUIRE(out == msg);
+    }
+
+    SECTION("Unset nested message") {
+        FlatOuter msg;
+        REQUIRE_FALSE(msg.tail.set(3).has_value());
+        auto buffer = GetBuffer<FlatOuter, integrity::None, TestType>();
+        REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+        FlatOuter out;
+        REQUIRE_FALSE(Deserialize(buffer, out).has_value());
+        REQUIRE(out == msg);
+    }
+}
+
+// Not flat (it has a string), so it takes the field-by-field path.
+struct PhaseInner {
+    static constexpr MessageId message_id = 0x510C;
+    Field<1, Optional, Float64<None>> x;
+    Field<2, Optional, String<3, None>> tag;
+    CRUNCH_MESSAGE_FIELDS(x, tag);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const PhaseInner&) const = default;
+};
+
+struct PhaseOuter {
+    static constexpr MessageId message_id = 0x510D;
+    Field<1, Optional, PhaseInner> inner;
+    Field<2, Optional, Int32<None>> tail;
+    CRUNCH_MESSAGE_FIELDS(inner, tail);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const PhaseOuter&) const = default;
+};
+
+TEST_CASE("StaticLayout: Aligned64 nested sizing uses the real field phase",
+          "[static]") {
+    using Layout = Aligned64Layout;
+    constexpr std::size_t Start = 8;
+
+    // inner presence @0, pad to 8, id @8, fields from 12:
+    // x @12/16, tag @24 (len @25, 3 chars), tail @32/36, end 40.
+    // Measured from 0 instead of 12, x would end at 16 and the nested
+    // payload would be 4 bytes longer than the bytes written.
+    REQUIRE(Layout::Size<PhaseOuter>() == Start + 40);
+
+    PhaseOuter msg;
+    PhaseInner inner;
+    REQUIRE_FALSE(inner.x.set(0.5).has_value());
+    REQUIRE_FALSE(inner.tag.set("abc").has_value());
+    msg.inner.set(inner);
+    REQUIRE_FALSE(msg.tail.set(-9).has_value());
+
+    std::array<std::byte, Start + 40> buffer{};
+    REQUIRE(Layout::Serialize(msg, buffer) == buffer.size());
+
+    SECTION("Set submessage") {
+        PhaseOuter out;
+        REQUIRE_FALSE(Layout::Deserialize(buffer, out).has_value());
+        REQUIRE(out == msg);
+    }
+
+    SECTION("Unset submessage is skipped by its real size") {
+        msg.inner.clear();
+        REQUIRE(Layout::Serialize(msg, buffer) == buffer.size());
+        PhaseOuter out;
+        REQUIRE_FALSE(Layout::Deserialize(buffer, out).has_value());
+        REQUIRE(out == msg);
+    }
+}
+
+struct SparseFrame {
+    static constexpr MessageId message_id = 0x510A;
+    Field<1, Optional, Int32<None>> seq;
+    Field<2, Optional, String<64, None>> note;
+    ArrayField<3, FlatMessage, 16, None> levels;
+    MapField<4, Int16<None>, String<8, None>, 8, None> tags;
+    Field<5, Optional, FlatOuter> unset;
+    CRUNCH_MESSAGE_FIELDS(seq, note, levels, tags, unset);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const SparseFrame&) const = default;
+};
+
+TEMPLATE_TEST_CASE("StaticLayout: skipping unused capacity", "[static]",
+                   (std::integral_constant<std::size_t, 1>),
+                   (std::integral_constant<std::size_t, 4>),
+                   (std::integral_constant<std::size_t, 8>)) {
+    using SkipLayout = StaticLayout<TestType::value, UnusedCapacity::Skip>;
+    using ZeroLayout = StaticLayout<TestType::value>;
+    constexpr std::size_t Size = ZeroLayout::template Size<SparseFrame>();
+    static_assert(SkipLayout::template Size<SparseFrame>() == Size);
+    static_assert(SkipLayout::GetFormat() == ZeroLayout::GetFormat());
+
+    SparseFrame msg;
+    REQUIRE_FALSE(msg.seq.set(77).has_value());
+    REQUIRE_FALSE(msg.note.set("short").has_value());
+    FlatMessage level;
+    REQUIRE_FALSE(level.a.set(int8_t{0x11}).has_value());
+    REQUIRE_FALSE(level.e.set(0xA1B2C3D4U).has_value());
+    REQUIRE_FALSE(msg.levels.add(level).has_value());
+    REQUIRE_FALSE(msg.tags.insert(int16_t{1}, "bid").has_value());
+    static_assert(SizedSerdesPolicy<SkipLayout, SparseFrame>);
+    static_assert(SkipLayout::SerializedSize(SparseFrame{}) == Size);
+    REQUIRE(SkipLayout::SerializedSize(msg) == Size);
+
+    SECTION("Matches zero-fill output on a zeroed buffer") {
+        std::array<std::byte, Size> zeroed{};
+        std::array<std::byte, Size> reference;
+        reference.fill(std::byte{0xEE});
+        REQUIRE(SkipLayout::Serialize(msg, zeroed) == Size);
+        REQUIRE(ZeroLayout::Serialize(msg, reference) == Size);
+        REQUIRE(std::ranges::equal(
+            std::span{zeroed}.subspan(StandardHeaderSize),
+            std::span{reference}.subspan(StandardHeaderSize)));
+    }
+
+    SECTION("Stale bytes are ignored on decode") {
+        std::array<std::byte, Size> stale;
+        stale.fill(std::byte{0xEE});
+        REQUIRE(SkipLayout::Serialize(msg, stale) == Size);
+
+        SparseFrame out;
+        REQUIRE_FALSE(SkipLayout::Deserialize(stale, out).has_value());
+        REQUIRE(out == msg);
+        // String capacity past the length is zero, not the stale bytes.
+        const auto tag = out.tags.at(int16_t{1});
+        REQUIRE(tag.has_value());
+        REQUIRE(std::ranges::all_of(std::span{(*tag)->buffer_}.subspan(3),
+                                    [](char c) { return c == '\0'; }));
+    }
+}
+
+struct RelayFrame {
+    static constexpr MessageId message_id = 0x510B;
+    Field<1, Optional, String<5, None>> route;
+    Field<2, Optional, UInt8<LessThan<64>>> hops;
+    Field<3, Optional, Float64<None>> timestamp;
+    ArrayField<4, Int16<None>, 3, None> path;
+    Field<5, Optional, UInt32<None>> seq;
+    CRUNCH_MESSAGE_FIELDS(route, hops, timestamp, path, seq);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const RelayFrame&) const = default;
+};
+
+// Any Decoder over these test messages would see every id at once.
+static_assert(detail::UniqueMessageIds<FlatMessage, FlatOuter, MixedOuter,
+                                       PhaseInner, PhaseOuter, SparseFrame,
+                                       RelayFrame>);
+
+TEMPLATE_TEST_CASE("StaticLayout: reading and patching single fields",
+                   "[static]", PackedLayout, Aligned32Layout,
+                   Aligned64Layout) {
+    constexpr std::size_t Size = TestType::template Size<RelayFrame>();
+
+    RelayFrame msg;
+    REQUIRE_FALSE(msg.route.set("a->b").has_value());
+    REQUIRE_FALSE(msg.hops.set(uint8_t{3}).has_value());
+    REQUIRE_FALSE(msg.timestamp.set(1700000000.125).has_value());
+    REQUIRE_FALSE(msg.path.add(int16_t{7}).has_value());
+    std::array<std::byte, Size> frame{};
+    REQUIRE(TestType::Serialize(msg, frame) == Size);
+
+    SECTION("OffsetOf points at the presence byte") {
+        REQUIRE(frame[TestType::template OffsetOf<RelayFrame, 1>()] ==
+                std::byte{1});
+        REQUIRE(frame[TestType::template OffsetOf<RelayFrame, 3>()] ==
+                std::byte{1});
+        REQUIRE(frame[TestType::template OffsetOf<RelayFrame, 5>()] ==
+                std::byte{0});
+        static_assert(TestType::template OffsetOf<RelayFrame, 1>() ==
+                      TestType::PayloadOffset());
+    }
+
+    SECTION("ReadField reads the serialized values") {
+        const auto hops = TestType::template ReadField<RelayFrame, 2>(frame);
+        REQUIRE(hops.value() == std::optional<uint8_t>{3});
+        const auto timestamp =
+            TestType::template ReadField<RelayFrame, 3>(frame);
+        REQUIRE(timestamp.value() == std::optional<double>{1700000000.125});
+        const auto seq = TestType::template ReadField<RelayFrame, 5>(frame);
+        REQUIRE_FALSE(seq.value().has_value());
+    }
+
+    SECTION("WriteField patches one field and leaves the rest") {
+        REQUIRE_FALSE(
+            TestType::template WriteField<RelayFrame, 2>(frame, uint8_t{4})
+                .has_value());
+        REQUIRE_FALSE(
+            TestType::template WriteField<RelayFrame, 5>(frame, 0xC0FFEEU)
+                .has_value());
+
+        REQUIRE_FALSE(msg.hops.set(uint8_t{4}).has_value());
+        REQUIRE_FALSE(msg.seq.set(0xC0FFEEU).has_value());
+        std::array<std::byte, Size> reencoded{};
+        REQUIRE(TestType::Serialize(msg, reencoded) == Size);
+        REQUIRE(frame == reencoded);
+    }
+
+    SECTION("WriteField runs the field's validators") {
+        const auto before = frame;
+        const auto err =
+            TestType::template WriteField<RelayFrame, 2>(frame, uint8_t{64});
+        REQUIRE(err.has_value());
+        REQUIRE(err->code == ErrorCode::ValidationFailed);
+        REQUIRE(frame == before);
+    }
+
+    SECTION("Short buffers are rejected") {
+        const auto short_frame = std::span{frame}.first(
+            TestType::template OffsetOf<RelayFrame, 5>() + 1);
+        REQUIRE_FALSE(
+            TestType::template ReadField<RelayFrame, 5>(short_frame)
+                .has_value());
+        REQUIRE(TestType::template WriteField<RelayFrame, 5>(short_frame, 1U)
+                    .has_value());
+        const auto hops =
+            TestType::template ReadField<RelayFrame, 2>(short_frame);
+        REQUIRE(hops.value() == std::optional<uint8_t>{3});
+    }
+}
@@ -1,10 +1,14 @@
+#include <algorithm>
+#include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <crunch/crunch.hpp>
 #include <crunch/crunch_detail.hpp>
 #include <crunch/fields/crunch_string.hpp>
 #include <crunch/messages/crunch_field.hpp>
 #include <crunch/messages/crunch_messages.hpp>  // For macro
 #include <crunch/serdes/crunch_tlv_layout.hpp>
 #include <cstdint>
+#include <limits>
 #include <span>
 #include <tuple>
 #include <vector>
@@ -378,3 +382,530 @@ TEST_CASE("TLV: Map length too short (truncated content)", "[tlv][error]") {
     auto err = TlvLayout::Deserialize(std::span{buffer}, msg);
     REQUIRE(err.has_value());
 }
+
+struct BulkArrayMessage {
+    static constexpr MessageId message_id = 1001;
+    ArrayField<1, Int32<None>, 100, None> ints;
+    ArrayField<2, Float64<None>, 40, None> doubles;
+    ArrayField<3, Bool<None>, 40, None> flags;
+    CRUNCH_MESSAGE_FIELDS(ints, doubles, flags);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const BulkArrayMessage&) const = default;
+};
+
+TEST_CASE("TLV: Packed scalar arrays longer than one batch", "[tlv]") {
+    BulkArrayMessage msg;
+    for (int32_t i = 0; i < 100; ++i) {
+        // Mix single-byte runs with negative (10-byte) varints.
+        const int32_t value = i < 40 ? i : (i % 3 == 0 ? -i * 7919 : i * 65537);
+        REQUIRE_FALSE(msg.ints.add(value).has_value());
+    }
+    for (int i = 0; i < 40; ++i) {
+        REQUIRE_FALSE(msg.doubles.add(i * 0.25 - 3.0).has_value());
+        REQUIRE_FALSE(msg.flags.add(i % 3 == 0).has_value());
+    }
+
+    std::vector<std::byte> buffer(TlvLayout::Size<BulkArrayMessage>());
+    const std::size_t written = TlvLayout::Serialize(msg, std::span{buffer});
+    buffer.resize(written);
+
+    BulkArrayMessage out;
+    REQUIRE_FALSE(TlvLayout::Deserialize(std::span{buffer}, out).has_value());
+    REQUIRE(out == msg);
+}
+
+TEST_CASE("TLV: packed arrays write nothing past their own bytes", "[tlv]") {
+    TestMessage msg;
+    REQUIRE_FALSE(msg.req_int.set(7).has_value());
+    REQUIRE_FALSE(msg.array_field.add(1).has_value());
+    REQUIRE_FALSE(msg.array_field.add(300).has_value());
+    REQUIRE_FALSE(msg.array_field.add(70000).has_value());
+
+    // The array is the last field, so any scratch bytes from the bulk
+    // Varint encoder would land past the end of the frame.
+    std::vector<std::byte> buffer(TlvLayout::Size<TestMessage>() + 16,
+                                  std::byte{0xAA});
+    const std::size_t written = TlvLayout::Serialize(msg, std::span{buffer});
+    REQUIRE(std::all_of(buffer.begin() + static_cast<std::ptrdiff_t>(written),
+                        buffer.end(),
+                        [](std::byte b) { return b == std::byte{0xAA}; }));
+
+    buffer.resize(written);
+    TestMessage out;
+    REQUIRE_FALSE(TlvLayout::Deserialize(std::span{buffer}, out).has_value());
+    REQUIRE(out == msg);
+}
+
+enum class Direction : int32_t { Back = -1, Stop = 0, Forward = 1 };
+
+struct SignedMessage {
+    static constexpr MessageId message_id = 1002;
+    Field<1, Optional, Int8<None>> i8;
+    Field<2, Optional, Int16<None>> i16;
+    Field<3, Optional, Int32<None>> i32;
+    Field<4, Optional, Enum<Direction, None>> dir;
+    Field<5, Optional, UInt32<None>> u32;
+    ArrayField<6, Int32<None>, 8, None> deltas;
+    MapField<7, Int16<None>, Int32<None>, 4, None> offsets;
+    CRUNCH_MESSAGE_FIELDS(i8, i16, i32, dir, u32, deltas, offsets);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const SignedMessage&) const = default;
+};
+
+static_assert(SerdesPolicy<TlvZigZagLayout, SignedMessage>);
+static_assert(TlvZigZagLayout::GetFormat() == Format::TLVZigZag);
+static_assert(TlvLayout::GetFormat() == Format::TLV);
+
+TEST_CASE("TLV ZigZag: small negative values are short", "[tlv][zigzag]") {
+    SignedMessage msg;
+    REQUIRE_FALSE(msg.i32.set(-1).has_value());
+
+    std::array<std::byte, TlvZigZagLayout::Size<SignedMessage>()> zigzag{};
+    std::array<std::byte, TlvLayout::Size<SignedMessage>()> twos{};
+    const std::size_t zigzag_size = TlvZigZagLayout::Serialize(msg, zigzag);
+    const std::size_t twos_size = TlvLayout::Serialize(msg, twos);
+
+    // Header + body length + tag + value
+    constexpr std::size_t Prefix = StandardHeaderSize + sizeof(uint32_t) + 1;
+    REQUIRE(zigzag_size == Prefix + 1);
+    REQUIRE(zigzag[Prefix] == std::byte{0x01});
+    // Two's complement -1 sets all 32 bits.
+    REQUIRE(twos_size == Prefix + Varint::max_varint_size(32));
+}
+
+TEST_CASE("TLV ZigZag: mapping and round trip", "[tlv][zigzag]") {
+    SignedMessage msg;
+    REQUIRE_FALSE(msg.i8.set(std::numeric_limits<int8_t>::min()).has_value());
+    REQUIRE_FALSE(
+        msg.i16.set(std::numeric_limits<int16_t>::max()).has_value());
+    REQUIRE_FALSE(msg.i32.set(-2).has_value());
+    REQUIRE_FALSE(msg.dir.set(Direction::Back).has_value());
+    REQUIRE_FALSE(msg.u32.set(0xFFFFFFFFU).has_value());
+    for (const int32_t d : {0, -1, 1, -64, 64, INT32_MIN, INT32_MAX}) {
+        REQUIRE_FALSE(msg.deltas.add(d).has_value());
+    }
+    REQUIRE_FALSE(msg.offsets.insert(int16_t{-3}, -300).has_value());
+    REQUIRE_FALSE(msg.offsets.insert(int16_t{3}, 300).has_value());
+
+    std::array<std::byte, TlvZigZagLayout::Size<SignedMessage>()> buffer{};
+    const std::size_t size = TlvZigZagLayout::Serialize(msg, buffer);
+
+    // Field 1 (i8 = -128) leads the body; -128 maps to 255 under ZigZag.
+    const auto body = std::span{buffer}.subspan(
+        StandardHeaderSize + sizeof(uint32_t),
+        size - StandardHeaderSize - sizeof(uint32_t));
+    REQUIRE(body[0] == std::byte{0x08});  // Tag(1, Varint)
+    REQUIRE(body[1] == std::byte{0xFF});  // -128 -> 255
+    REQUIRE(body[2] == std::byte{0x01});
+
+    SignedMessage out;
+    REQUIRE_FALSE(
+        TlvZigZagLayout::Deserialize(std::span{buffer}.first(size), out)
+            .has_value());
+    REQUIRE(out == msg);
+}
+
+TEST_CASE("TLV ZigZag: header format distinguishes layouts", "[tlv][zigzag]") {
+    SignedMessage msg;
+    REQUIRE_FALSE(msg.i32.set(-5).has_value());
+    auto buffer = GetBuffer<SignedMessage, integrity::None, TlvZigZagLayout>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+
+    SignedMessage out;
+    REQUIRE_FALSE(Deserialize(buffer, out).has_value());
+    REQUIRE(out.i32.get() == -5);
+
+    const auto result = Crunch::detail::Deserialize<integrity::None, TlvLayout>(
+        buffer.serialized_message_span(), out);
+    REQUIRE(result.has_value());
+    REQUIRE(result.value() == Error::invalid_format());
+}
+
+struct FloatMessage {
+    static constexpr MessageId message_id = 1003;
+    Field<1, Optional, Float64<None>> f64;
+    Field<2, Optional, Float32<None>> f32;
+    ArrayField<3, Float32<None>, 8, None> samples;
+    MapField<4, Int32<None>, Float64<None>, 4, None> readings;
+    CRUNCH_MESSAGE_FIELDS(f64, f32, samples, readings);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const FloatMessage&) const = default;
+};
+
+TEST_CASE("TLV: floats use fixed-width wire types", "[tlv][fixed]") {
+    FloatMessage msg;
+    REQUIRE_FALSE(msg.f64.set(-1.5).has_value());
+    REQUIRE_FALSE(msg.f32.set(0.25F).has_value());
+
+    std::array<std::byte, TlvLayout::Size<FloatMessage>()> buffer{};
+    const std::size_t size = TlvLayout::Serialize(msg, buffer);
+
+    const auto body = std::span{buffer}.subspan(
+        StandardHeaderSize + sizeof(uint32_t),
+        size - StandardHeaderSize - sizeof(uint32_t));
+    // Tag(1, Fixed64) | 8 bytes | Tag(2, Fixed32) | 4 bytes
+    REQUIRE(size == StandardHeaderSize + sizeof(uint32_t) + 1 + 8 + 1 + 4);
+    REQUIRE(body[0] == std::byte{(1 << 3) | 3});
+    REQUIRE(Crunch::LittleEndian(std::bit_cast<double>(
+                std::array{body[1], body[2], body[3], body[4], body[5],
+                           body[6], body[7], body[8]})) == -1.5);
+    REQUIRE(body[9] == std::byte{(2 << 3) | 2});
+    REQUIRE(Crunch::LittleEndian(std::bit_cast<float>(
+                std::array{body[10], body[11], body[12], body[13]})) ==
+            0.25F);
+
+    FloatMessage out;
+    REQUIRE_FALSE(
+        TlvLayout::Deserialize(std::span{buffer}.first(size), out).has_value());
+    REQUIRE(out == msg);
+}
+
+TEST_CASE("TLV: float arrays and maps round trip", "[tlv][fixed]") {
+    FloatMessage msg;
+    for (const float f : {0.0F, -0.0F, 1.0F, -3.75F,
+                          std::numeric_limits<float>::max(),
+                          std::numeric_limits<float>::denorm_min()}) {
+        REQUIRE_FALSE(msg.samples.add(f).has_value());
+    }
+    REQUIRE_FALSE(msg.readings.insert(-7, 2.5).has_value());
+    REQUIRE_FALSE(
+        msg.readings.insert(9, std::numeric_limits<double>::lowest())
+            .has_value());
+
+    std::array<std::byte, TlvLayout::Size<FloatMessage>()> buffer{};
+    const std::size_t size = TlvLayout::Serialize(msg, buffer);
+
+    FloatMessage out;
+    REQUIRE_FALSE(
+        TlvLayout::Deserialize(std::span{buffer}.first(size), out).has_value());
+    REQUIRE(out == msg);
+
+    // Truncating inside the fixed-width elements is reported, not over-read.
+    FloatMessage truncated;
+    auto short_buffer = std::vector<std::byte>(buffer.begin(),
+                                               buffer.begin() + 24);
+    REQUIRE(TlvLayout::Deserialize(std::span{short_buffer}, truncated)
+                .has_value());
+}
+
+TEST_CASE("TLV: floats must carry their fixed-width wire type",
+          "[tlv][fixed]") {
+    // Tag(2, Varint) | varint(bit pattern of 1.0F = 0x3F800000)
+    std::vector<std::byte> payload = {std::byte{0x10}, std::byte{0x80},
+                                      std::byte{0x80}, std::byte{0x80},
+                                      std::byte{0xFC}, std::byte{0x03}};
+    auto buffer =
+        create_valid_message_buffer<FloatMessage::message_id>(payload);
+
+    FloatMessage msg;
+    REQUIRE(TlvLayout::Deserialize(std::span{buffer}, msg).has_value());
+
+    // A float tagged with the wrong fixed width is rejected.
+    payload = {std::byte{(2 << 3) | 3}, std::byte{0}, std::byte{0},
+               std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0},
+               std::byte{0}, std::byte{0}};
+    buffer = create_valid_message_buffer<FloatMessage::message_id>(payload);
+    REQUIRE(TlvLayout::Deserialize(std::span{buffer}, msg).has_value());
+}
+
+TEST_CASE("TLV: frames with the Varint-float format are rejected",
+          "[tlv][fixed]") {
+    FloatMessage msg;
+    REQUIRE_FALSE(msg.samples.add(1.0F).has_value());
+    REQUIRE_FALSE(msg.readings.insert(3, 2.5).has_value());
+
+    // An older peer labels the same body with the Varint-float format 0x04.
+    auto buffer = GetBuffer<FloatMessage, integrity::None, TlvLayout>();
+    REQUIRE_FALSE(Serialize(buffer, msg).has_value());
+    buffer.data[1] = std::byte{0x04};
+
+    FloatMessage out;
+    const auto err = Deserialize(buffer, out);
+    REQUIRE(err.has_value());
+    REQUIRE(err->code == ErrorCode::InvalidFormat);
+}
+
+struct NestLeaf {
+    static constexpr MessageId message_id = 1004;
+    Field<1, Optional, String<200, None>> text;
+    MapField<2, Int32<None>, String<8, None>, 4, None> labels;
+    CRUNCH_MESSAGE_FIELDS(text, labels);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const NestLeaf&) const = default;
+};
+
+struct NestMiddle {
+    static constexpr MessageId message_id = 1005;
+    Field<1, Optional, NestLeaf> leaf;
+    ArrayField<2, NestLeaf, 2, None> leaves;
+    CRUNCH_MESSAGE_FIELDS(leaf, leaves);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const NestMiddle&) const = default;
+};
+
+struct NestOuter {
+    static constexpr MessageId message_id = 1006;
+    Field<1, Optional, NestMiddle> middle;
+    Field<2, Optional, Int32<None>> trailer;
+    CRUNCH_MESSAGE_FIELDS(middle, trailer);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const NestOuter&) const = default;
+};
+
+TEST_CASE("TLV: nested length prefixes are written at their final width",
+          "[tlv]") {
+    NestLeaf leaf;
+    REQUIRE_FALSE(leaf.text.set(std::string(150, 'x')).has_value());
+    REQUIRE_FALSE(leaf.labels.insert(1, "one").has_value());
+
+    NestOuter msg;
+    NestMiddle middle;
+    middle.leaf.set(leaf);
+    REQUIRE_FALSE(middle.leaves.add(leaf).has_value());
+    REQUIRE_FALSE(middle.leaves.add(NestLeaf{}).has_value());
+    msg.middle.set(middle);
+    REQUIRE_FALSE(msg.trailer.set(7).has_value());
+
+    std::array<std::byte, TlvLayout::Size<NestOuter>()> buffer{};
+    const std::size_t size = TlvLayout::Serialize(msg, buffer);
+
+    // Leaf: text tag + 1-byte len + 150 | labels tag + len + count + key +
+    // string len + "one"
+    constexpr std::size_t LeafSize = (1 + 2 + 150) + (1 + 1 + 1 + 1 + 1 + 3);
+    // Middle: leaf tag + len + leaf | leaves tag + len + count + 2 leaves
+    constexpr std::size_t LeavesSize = 1 + (2 + LeafSize) + (1 + 0);
+    constexpr std::size_t MiddleSize =
+        (1 + 2 + LeafSize) + (1 + 2 + LeavesSize);
+    const auto body = std::span{buffer}.subspan(
+        StandardHeaderSize + sizeof(uint32_t), size);
+    REQUIRE(size == StandardHeaderSize + sizeof(uint32_t) +
+                        (1 + 2 + MiddleSize) + (1 + 1));
+    REQUIRE(body[0] == std::byte{(1 << 3) | 1});
+    const auto middle_len = Varint::decode(body, 1);
+    REQUIRE(middle_len.has_value());
+    REQUIRE(middle_len->first == MiddleSize);
+    REQUIRE(middle_len->second == 2);
+
+    NestOuter out;
+    REQUIRE_FALSE(
+        TlvLayout::Deserialize(std::span{buffer}.first(size), out).has_value());
+    REQUIRE(out == msg);
+}
+
+struct SparseIdMessage {
+    static constexpr MessageId message_id = 1007;
+    Field<1000, Optional, Int32<None>> a;
+    Field<3, Optional, Int32<None>> b;
+    Field<500000, Optional, Int32<None>> c;
+    CRUNCH_MESSAGE_FIELDS(a, b, c);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const SparseIdMessage&) const = default;
+};
+
+TEST_CASE("TLV: fields decode in any order", "[tlv][dispatch]") {
+    SECTION("Dense ids") {
+        // Tag(4, LengthDelimited) array {5} | Tag(2) 42 | Tag(1) 7
+        std::vector<std::byte> payload = {
+            std::byte{0x21}, std::byte{0x02}, std::byte{0x01},
+            std::byte{0x05}, std::byte{0x10}, std::byte{0x2A},
+            std::byte{0x08}, std::byte{0x07}};
+        auto buffer =
+            create_valid_message_buffer<TestMessage::message_id>(payload);
+
+        TestMessage msg;
+        REQUIRE_FALSE(
+            TlvLayout::Deserialize(std::span{buffer}, msg).has_value());
+        REQUIRE(msg.opt_int.get() == 7);
+        REQUIRE(msg.req_int.get() == 42);
+        REQUIRE(msg.array_field.size() == 1);
+        REQUIRE(msg.array_field[0].get() == 5);
+    }
+
+    SECTION("Sparse ids") {
+        SparseIdMessage msg;
+        REQUIRE_FALSE(msg.a.set(-1).has_value());
+        REQUIRE_FALSE(msg.b.set(2).has_value());
+        REQUIRE_FALSE(msg.c.set(3).has_value());
+
+        std::array<std::byte, TlvLayout::Size<SparseIdMessage>()> buffer{};
+        const std::size_t size = TlvLayout::Serialize(msg, buffer);
+        SparseIdMessage out;
+        REQUIRE_FALSE(TlvLayout::Deserialize(std::span{buffer}.first(size), out)
+                          .has_value());
+        REQUIRE(out == msg);
+
+        // Tag(3) 9 | Tag(500000) 8 | Tag(1000) 7
+        std::vector<std::byte> payload = {
+            std::byte{0x18}, std::byte{0x09}, std::byte{0x80}, std::byte{0x92},
+            std::byte{0xF4}, std::byte{0x01}, std::byte{0x08}, std::byte{0xC0},
+            std::byte{0x3E}, std::byte{0x07}};
+        auto reordered =
+            create_valid_message_buffer<SparseIdMessage::message_id>(payload);
+        REQUIRE_FALSE(
+            TlvLayout::Deserialize(std::span{reordered}, out).has_value());
+        REQUIRE(out.a.get() == 7);
+        REQUIRE(out.b.get() == 9);
+        REQUIRE(out.c.get() == 8);
+    }
+
+    SECTION("Ids between, below and above the declared ids are unknown") {
+        // Ids 2, 0, 4 and 15, all with the Varint wire type.
+        for (const std::byte tag : {std::byte{0x10}, std::byte{0x00},
+                                    std::byte{0x20}, std::byte{0x78}}) {
+            CAPTURE(std::to_integer<int>(tag));
+            std::vector<std::byte> payload = {tag, std::byte{0x01}};
+            auto buffer =
+                create_valid_message_buffer<SparseIdMessage::message_id>(
+                    payload);
+            SparseIdMessage out;
+            const auto err = TlvLayout::Deserialize(std::span{buffer}, out);
+            REQUIRE(err.has_value());
+            REQUIRE(err->message == "unknown fields present");
+        }
+    }
+}
+
+static_assert(SizedSerdesPolicy<TlvLayout, NestOuter>);
+static_assert(SizedSerdesPolicy<TlvZigZagLayout, NestOuter>);
+
+TEST_CASE("TLV: SerializedSize matches the bytes Serialize writes",
+          "[tlv][size]") {
+    std::array<std::byte, TlvLayout::Size<NestOuter>()> buffer{};
+
+    NestOuter msg;
+    REQUIRE(TlvLayout::SerializedSize(msg) ==
+            TlvLayout::Serialize(msg, buffer));
+    REQUIRE(TlvLayout::SerializedSize(msg) ==
+            StandardHeaderSize + sizeof(uint32_t));
+
+    REQUIRE_FALSE(msg.trailer.set(-1).has_value());
+    REQUIRE(TlvLayout::SerializedSize(msg) ==
+            TlvLayout::Serialize(msg, buffer));
+    REQUIRE(TlvZigZagLayout::SerializedSize(msg) ==
+            TlvZigZagLayout::Serialize(msg, buffer));
+    REQUIRE(TlvZigZagLayout::SerializedSize(msg) <
+            TlvLayout::SerializedSize(msg));
+
+    NestLeaf leaf;
+    REQUIRE_FALSE(leaf.text.set(std::string(130, 'y')).has_value());
+    REQUIRE_FALSE(leaf.labels.insert(-300, "neg").has_value());
+    REQUIRE_FALSE(leaf.labels.insert(2, "").has_value());
+    NestMiddle middle;
+    middle.leaf.set(leaf);
+    REQUIRE_FALSE(middle.leaves.add(leaf).has_value());
+    msg.middle.set(middle);
+    const std::size_t size = TlvLayout::Serialize(msg, buffer);
+    REQUIRE(TlvLayout::SerializedSize(msg) == size);
+    REQUIRE(size < TlvLayout::Size<NestOuter>());
+
+    // The top-level API adds the checksum.
+    REQUIRE(SerializedSize<NestOuter, integrity::CRC32C, TlvLayout>(msg) ==
+            size + integrity::CRC32C::size());
+}
+
+struct TinyMessage {
+    static constexpr MessageId message_id = 1008;
+    Field<1, Optional, UInt8<None>> level;
+    Field<2, Optional, Bool<None>> armed;
+    CRUNCH_MESSAGE_FIELDS(level, armed);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const TinyMessage&) const = default;
+};
+
+// Header + length + (1-byte tag + 2-byte UInt8 varint) + (tag + bool).
+static_assert(TlvLayout::Size<TinyMessage>() ==
+              StandardHeaderSize + sizeof(uint32_t) + 3 + 2);
+
+struct LoadedMessage {
+    static constexpr MessageId message_id = 1009;
+    Field<1, Optional, Int8<None>> i8;
+    Field<2, Optional, Int32<None>> i32;
+    Field<15, Optional, UInt32<None>> u32;
+    Field<16, Optional, Enum<Direction, None>> dir;
+    Field<2047, Optional, Bool<None>> flag;
+    Field<2048, Optional, Float64<None>> f64;
+    Field<300000, Optional, String<130, None>> text;
+    Field<4, Optional, NestLeaf> leaf;
+    ArrayField<5, Int16<None>, 70, None> samples;
+    ArrayField<6, Float32<None>, 3, None> gains;
+    ArrayField<7, String<4, None>, 2, None> names;
+    MapField<8, UInt16<None>, Int32<None>, 2, None> offsets;
+    CRUNCH_MESSAGE_FIELDS(i8, i32, u32, dir, flag, f64, text, leaf, samples,
+                          gains, names, offsets);
+    constexpr auto Validate() const -> std::optional<Error> {
+        return std::nullopt;
+    }
+    bool operator==(const LoadedMessage&) const = default;
+};
+
+template <typename Layout>
+void RequireLoadedMessageReachesSize() {
+    LoadedMessage msg;
+    REQUIRE_FALSE(msg.i8.set(std::numeric_limits<int8_t>::min()).has_value());
+    REQUIRE_FALSE(
+        msg.i32.set(std::numeric_limits<int32_t>::min()).has_value());
+    REQUIRE_FALSE(
+        msg.u32.set(std::numeric_limits<uint32_t>::max()).has_value());
+    REQUIRE_FALSE(msg.dir.set(static_cast<Direction>(
+                                  std::numeric_limits<int32_t>::min()))
+                      .has_value());
+    REQUIRE_FALSE(msg.flag.set(true).has_value());
+    REQUIRE_FALSE(msg.f64.set(-1.5).has_value());
+    REQUIRE_FALSE(msg.text.set(std::string(130, 't')).has_value());
+    NestLeaf leaf;
+    REQUIRE_FALSE(leaf.text.set(std::string(200, 'l')).has_value());
+    for (int32_t k = 0; k < 4; ++k) {
+        REQUIRE_FALSE(leaf.labels
+                          .insert(std::numeric_limits<int32_t>::min() + k,
+                                  "eightchr")
+                          .has_value());
+    }
+    msg.leaf.set(leaf);
+    for (int i = 0; i < 70; ++i) {
+        REQUIRE_FALSE(
+            msg.samples.add(std::numeric_limits<int16_t>::min()).has_value());
+    }
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE_FALSE(msg.gains.add(0.5f).has_value());
+    }
+    REQUIRE_FALSE(msg.names.add(String<4, None>{"abcd"}).has_value());
+    REQUIRE_FALSE(msg.names.add(String<4, None>{"efgh"}).has_value());
+    REQUIRE_FALSE(msg.offsets
+                      .insert(uint16_t{0xFFFF},
+                              std::numeric_limits<int32_t>::min())
+                      .has_value());
+    REQUIRE_FALSE(msg.offsets
+                      .insert(uint16_t{0xFFFE},
+                              std::numeric_limits<int32_t>::min())
+                      .has_value());
+
+    std::array<std::byte, Layout::template Size<LoadedMessage>()> buffer{};
+    const std::size_t written = Layout::Serialize(msg, buffer);
+    REQUIRE(written == Layout::template Size<LoadedMessage>());
+
+    LoadedMessage out;
+    REQUIRE_FALSE(Layout::Deserialize(buffer, out).has_value());
+    REQUIRE(out == msg);
+}
+
+TEST_CASE("TLV: Size is reached exactly by a fully loaded message",
+          "[tlv][size]") {
+    RequireLoadedMessageReachesSize<TlvLayout>();
+    RequireLoadedMessageReachesSize<TlvZigZagLayout>();
+}
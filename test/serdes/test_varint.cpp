@@ -85,3 +85,91 @@ TEST_CASE("Varint Size Calculation", "[varint]") {
     REQUIRE(Varint::size(16384) == 3);
     REQUIRE(Varint::size(std::numeric_limits<uint64_t>::max()) == 10);
 }
+
+namespace {
+// Values covering every encoded length from 1 to 10 bytes.
+std::vector<uint64_t> LengthSweep() {
+    std::vector<uint64_t> values;
+    for (int bits = 0; bits <= 64; ++bits) {
+        const uint64_t top = bits == 64 ? ~uint64_t{0}
+                                        : (uint64_t{1} << bits) - 1;
+        values.push_back(top);
+        values.push_back(top + 1);
+        values.push_back(top / 3);
+    }
+    return values;
+}
+
+std::vector<std::byte> EncodeBytewise(const std::vector<uint64_t>& values) {
+    std::vector<std::byte> out(values.size() * Varint::max_size);
+    std::size_t offset = 0;
+    for (const uint64_t v : values) {
+        offset += Varint::encode(v, out, offset);
+    }
+    out.resize(offset);
+    return out;
+}
+}  // namespace
+
+static_assert([] {
+    std::array<std::byte, 10> buf{};
+    const std::size_t n = Varint::encode(300, buf, 0);
+    const auto res = Varint::decode(std::span{buf}.first(n), 0);
+    return n == 2 && res && res->first == 300 && res->second == 2;
+}());
+
+TEST_CASE("Varint word decode matches byte loop", "[varint]") {
+    for (const uint64_t v : LengthSweep()) {
+        CAPTURE(v);
+        // Padding after the varint lets the 8-byte word path run.
+        std::array<std::byte, 32> buffer;
+        buffer.fill(std::byte{0xFF});
+        const std::size_t len = Varint::encode(v, buffer, 3);
+
+        auto padded = Varint::decode(buffer, 3);
+        REQUIRE(padded.has_value());
+        REQUIRE(padded->first == v);
+        REQUIRE(padded->second == len);
+
+        // Exact-size buffer forces the byte loop near the end.
+        auto exact = Varint::decode(std::span{buffer}.first(3 + len), 3);
+        REQUIRE(exact == padded);
+
+        auto truncated =
+            Varint::decode(std::span{buffer}.first(3 + len - 1), 3);
+        REQUIRE_FALSE(truncated.has_value());
+    }
+}
+
+TEST_CASE("Varint bulk encode and decode", "[varint]") {
+    std::vector<uint64_t> values = LengthSweep();
+    // Long run of single-byte values for the 16-byte path.
+    for (uint64_t i = 0; i < 50; ++i) {
+        values.push_back(i);
+    }
+    const auto expected = EncodeBytewise(values);
+
+    std::vector<std::byte> encoded(values.size() * Varint::max_size + 8);
+    const std::size_t written = Varint::encode_n(values, encoded, 0);
+    REQUIRE(written == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), encoded.begin()));
+
+    std::vector<uint64_t> decoded(values.size());
+    const auto consumed = Varint::decode_n(expected, 0, decoded);
+    REQUIRE(consumed.has_value());
+    REQUIRE(*consumed == expected.size());
+    REQUIRE(decoded == values);
+
+    // Asking for one more value than is present fails.
+    std::vector<uint64_t> too_many(values.size() + 1);
+    REQUIRE_FALSE(Varint::decode_n(expected, 0, too_many).has_value());
+}
+
+TEST_CASE("Varint bulk encode stays inside the output", "[varint]") {
+    const std::vector<uint64_t> values = {1, 300, 70000};
+    std::array<std::byte, 6> exact;  // 1 + 2 + 3 bytes
+    REQUIRE(Varint::encode_n(values, exact, 0) == 6);
+    std::array<uint64_t, 3> decoded;
+    REQUIRE(Varint::decode_n(exact, 0, decoded) == 6);
+    REQUIRE(std::equal(values.begin(), values.end(), decoded.begin()));
+}